@@ -9,14 +9,20 @@
 #define BIGINT_H
 
 #include <algorithm>
+#include <cstdint>
 #include <iostream>
 #include <string>
+#include <utility>
 #include <vector>
 #include <unistd.h>
 #include <cmath>
+#if __cplusplus >= 202002L
+#include <compare>
+#endif
 
 #include "number.h"
 #include "bigintexception.h"
+#include "limbs.h"
 
 template <size_t Base>
 class BigInt : public Number {
@@ -26,7 +32,10 @@ class BigInt : public Number {
   BigInt(std::string &);
   BigInt(const char *);
   BigInt(const BigInt<Base> &);
+  BigInt(BigInt<Base> &&) noexcept;
   BigInt(const std::vector<char> &,const int & );
+  BigInt(const std::vector<uint64_t> &, int);
+  BigInt(std::vector<uint64_t> &&, int);
 
   // cambio de tipo
   operator BigInt<2>() const override;
@@ -37,8 +46,9 @@ class BigInt : public Number {
   // constructor virtual de Number con sobrecarga de operator=
   Number& operator=(const Number&) override;
 
-  // asignación (copia)
+  // asignación (copia y movimiento)
   BigInt<Base> &operator=(const BigInt<Base> &);
+  BigInt<Base> &operator=(BigInt<Base> &&) noexcept;
 
   // entrada / salida (E/S)
   template <size_t Base_t>
@@ -47,10 +57,11 @@ class BigInt : public Number {
   friend std::istream& operator>>(std::istream&, BigInt<Base_t>&);
 
   // getters y setters
-  BigInt<Base> setSign(int);
-  BigInt<Base> setDigits(std::vector<char>);
+  BigInt<Base> &setSign(int);
+  BigInt<Base> &setDigits(const std::vector<char> &);
   int getSign() const;
-  std::vector<char> getDigits() const;
+  std::vector<char> getDigits() const;  // vista desempaquetada: construye un vector nuevo
+  const std::vector<uint64_t> &getLimbs() const;
 
   // método to_string (to_s)
   std::string to_string() const;
@@ -62,10 +73,12 @@ class BigInt : public Number {
   // métodos de modificación y comprobación
   BigInt<Base> FillZeros(unsigned) const ;
   bool IsZero() const;
+  bool IsNegative() const;
   BigInt<Base> Abs() const;
-  BigInt<Base> PushBack(char);
+  BigInt<Base> &PushBack(char);
 
-  // operadores de comparación
+  // operadores de comparación (todos se apoyan en compare, que no reserva memoria)
+  int compare(const BigInt<Base> &) const;  // -1, 0 o 1
   template <size_t Base_t>
   friend bool operator==(const BigInt<Base> &, const BigInt<Base> &);
   bool operator!=(const BigInt<Base> &) const;
@@ -75,6 +88,9 @@ class BigInt : public Number {
   template <size_t Base_t>
   friend bool operator<(const BigInt<Base> &, const BigInt<Base> &);
   bool operator<=(const BigInt<Base> &) const;
+#if __cplusplus >= 202002L
+  std::strong_ordering operator<=>(const BigInt<Base> &) const;
+#endif
 
   // incremento y decremento
   BigInt<Base> &operator++();    // pre-incremento
@@ -91,13 +107,33 @@ class BigInt : public Number {
   template <size_t Base_t>
   friend BigInt<Base> operator/(const BigInt<Base> &, const BigInt<Base> &);
   BigInt<Base> operator%(const BigInt<Base> &) const;
+  std::pair<BigInt<Base>, BigInt<Base>> DivMod(const BigInt<Base> &) const;
   template <size_t Base_t>
-  friend BigInt<Base> pow(const BigInt<Base> &, const BigInt<Base> &);
+  friend BigInt<Base_t> pow(const BigInt<Base_t> &, const BigInt<Base_t> &);
   BigInt<Base> operator^(const BigInt<Base> &) const;
+  BigInt<Base> PowMod(const BigInt<Base> &, const BigInt<Base> &) const;  // x^e mod m sin construir x^e
+
+  // teoría de números (el mcd y el mcm nunca son negativos)
+  BigInt<Base> Gcd(const BigInt<Base> &) const;
+  BigInt<Base> ExtendedGcd(const BigInt<Base> &, BigInt<Base> &, BigInt<Base> &) const;  // g = s x + t y
+  BigInt<Base> ModInverse(const BigInt<Base> &) const;  // en [0, |m|)
+  BigInt<Base> Lcm(const BigInt<Base> &) const;
+
+  // asignación compuesta (en el lugar, reutiliza el almacenamiento del operando izquierdo)
+  BigInt<Base> &operator+=(const BigInt<Base> &);
+  BigInt<Base> &operator-=(const BigInt<Base> &);
+  BigInt<Base> &operator*=(const BigInt<Base> &);
+  BigInt<Base> &operator/=(const BigInt<Base> &);
+  BigInt<Base> &operator%=(const BigInt<Base> &);
+  BigInt<Base> &operator<<=(size_t);  // multiplica por Base^n
+  BigInt<Base> &operator>>=(size_t);  // divide por Base^n (truncando)
+
+  // operadores de desplazamiento de dígitos
+  BigInt<Base> operator<<(size_t) const;
+  BigInt<Base> operator>>(size_t) const;
 
   // extra
   BigInt<Base> operator!() const;
-  BigInt<Base> operator+=(const BigInt<Base> &) const;
 
   // métodos implementados por la clase BigInt declarados en la clase abstracta Number
   Number* add(const Number*) const override;
@@ -105,8 +141,21 @@ class BigInt : public Number {
   Number* multiply(const Number*) const override;
   Number* divide(const Number*) const override;
   Number* module(const Number*) const override;
+  std::pair<Number*, Number*> divmod(const Number*) const override;
   Number* pow(const Number*) const override;
+  Number* powmod(const Number*, const Number*) const override;
+  Number* fact() const override;
+  Number* gcd(const Number*) const override;
+  Number* lcm(const Number*) const override;
+  Number* modinv(const Number*) const override;
+  std::pair<Number*, Number*> xgcd(const Number*) const override;
   Number *addEqual(const Number *) const override;
+  Number *shiftLeft(const Number *) const override;
+  Number *shiftRight(const Number *) const override;
+  Number *bitAnd(const Number *) const override;
+  Number *bitOr(const Number *) const override;
+  Number *bitXor(const Number *) const override;
+  Number *bitNot() const override;
 
   std::ostream& write(std::ostream&) const override;
   std::istream& read(std::istream&)  override;
@@ -115,7 +164,20 @@ class BigInt : public Number {
   ~BigInt() override{}
 
  private:
-  std::vector<char> digits_;  // dígitos que conforman el número
+  template <size_t Base_t>
+  friend class BigInt;  // las conversiones entre bases construyen directamente desde los limbs
+
+  // los limbs que devuelve Limbs ya están en radix Base^k: se toman sin validar (solo se normalizan)
+  enum Unchecked { kUnchecked };
+  BigInt(std::vector<uint64_t> &&, int, Unchecked);
+
+  // invariante: sin limbs a 0 por la izquierda, el 0 es el vector vacío y siempre tiene signo 1
+  void Normalize();
+  static constexpr size_t kMaxShift = static_cast<size_t>(1) << 30;  // mayor desplazamiento a la izquierda
+  static constexpr size_t kMaxFactorial = static_cast<size_t>(1) << 24;  // mayor argumento del factorial
+  size_t ShiftCount(size_t) const;  // valor absoluto como número de posiciones (acotado)
+
+  std::vector<uint64_t> limbs_;  // limbs que conforman el número (radix Base^k, del menos al más significativo)
   int sign_;  // positivo: signo = 1 / negativo: signo = -1
 };
 
@@ -132,16 +194,18 @@ class BigInt<2> : public Number {
   // constructor
   BigInt(long number_x = 0);
   BigInt(const BigInt<2> &other);
-  BigInt(std::vector<bool> digits);
+  BigInt(BigInt<2> &&other) noexcept;
+  BigInt(const std::vector<bool> &digits);
   BigInt(const std::vector<char> &, const int &);  // necesario para BigInt<2>::operator BigInt<Base>() const
   BigInt(std::string number_x);
 
-  // asignación (copia)
-  BigInt operator=(const BigInt<2> &other);
+  // asignación (copia y movimiento)
+  BigInt<2> &operator=(const BigInt<2> &other);
+  BigInt<2> &operator=(BigInt<2> &&other) noexcept;
 
   // cambio de tipo
   template <size_t base>
-  BigInt<base> ConvertBaseT();
+  BigInt<base> ConvertBaseT() const;
   operator BigInt<2>() const override;
   operator BigInt<8>() const override;
   operator BigInt<10>() const override;
@@ -151,8 +215,8 @@ class BigInt<2> : public Number {
   Number& operator=(const Number&) override;
 
   // getters y setters
-  std::vector<bool> getDigits() const;
-  BigInt<2> setDigits(std::vector<bool> digits);
+  std::vector<bool> getDigits() const;  // vista desempaquetada: construye un vector nuevo
+  BigInt<2> &setDigits(const std::vector<bool> &digits);
 
   // métodos de acceso
   bool operator[](size_t) const;
@@ -164,12 +228,16 @@ class BigInt<2> : public Number {
   BigInt<2> Abs() const;
 
   // operadores de comparación
+  int compare(const BigInt<2> &other) const;  // -1, 0 o 1
   friend bool operator==(const BigInt<2> &, const BigInt<2> &);
   bool operator!=(const BigInt<2> &other) const;
   friend bool operator>(const BigInt<2> &, const BigInt<2> &);
   bool operator>=(const BigInt<2> &other) const;
   friend bool operator<(const BigInt<2> &, const BigInt<2> &);
   bool operator<=(const BigInt<2> &other) const;
+#if __cplusplus >= 202002L
+  std::strong_ordering operator<=>(const BigInt<2> &other) const;
+#endif
 
   // incremento y decremento
   BigInt<2> &operator++();    // pre-incremento
@@ -179,18 +247,51 @@ class BigInt<2> : public Number {
 
   // operadores aritméticos
   friend BigInt<2> operator+(const BigInt<2> &first, const BigInt<2> &other);
-  BigInt<2> suma_overflow(const BigInt<2> &first, const BigInt<2> &other) const;
   BigInt<2> operator-() const;
   BigInt<2> operator-(const BigInt<2> &other) const;
   BigInt<2> operator*(const BigInt<2> &other) const;
   friend BigInt<2> operator/(const BigInt<2> &first, const BigInt<2> &other);
   BigInt<2> operator%(const BigInt<2> &other) const;
+  std::pair<BigInt<2>, BigInt<2>> DivMod(const BigInt<2> &other) const;
   friend BigInt<2> pow(const BigInt<2> &first, const BigInt<2> &other);
   BigInt<2> operator^(const BigInt<2> &other) const;
+  BigInt<2> PowMod(const BigInt<2> &exponent, const BigInt<2> &modulus) const;  // x^e mod m sin construir x^e
+
+  // teoría de números (el mcd y el mcm nunca son negativos)
+  BigInt<2> Gcd(const BigInt<2> &other) const;
+  BigInt<2> ExtendedGcd(const BigInt<2> &other, BigInt<2> &s, BigInt<2> &t) const;  // g = s x + t y
+  BigInt<2> ModInverse(const BigInt<2> &modulus) const;  // en [0, |m|)
+  BigInt<2> Lcm(const BigInt<2> &other) const;
+
+  // asignación compuesta (en el lugar, reutiliza el almacenamiento del operando izquierdo)
+  BigInt<2> &operator+=(const BigInt<2> &other);
+  BigInt<2> &operator-=(const BigInt<2> &other);
+  BigInt<2> &operator*=(const BigInt<2> &other);
+  BigInt<2> &operator/=(const BigInt<2> &other);
+  BigInt<2> &operator%=(const BigInt<2> &other);
+  BigInt<2> &operator<<=(size_t n);  // multiplica por 2^n
+  BigInt<2> &operator>>=(size_t n);  // desplazamiento aritmético: divide por 2^n redondeando hacia abajo
 
   // operadores de desplazamiento
-  void operator<<(size_t n);
-  void operator>>(size_t n);
+  BigInt<2> operator<<(size_t n) const;
+  BigInt<2> operator>>(size_t n) const;
+
+  // operaciones lógicas bit a bit en complemento a 2 (el XOR no es operator^, que es la potencia)
+  BigInt<2> operator&(const BigInt<2> &other) const;
+  BigInt<2> operator|(const BigInt<2> &other) const;
+  BigInt<2> Xor(const BigInt<2> &other) const;
+  BigInt<2> operator~() const;
+  BigInt<2> &operator&=(const BigInt<2> &other);
+  BigInt<2> &operator|=(const BigInt<2> &other);
+  BigInt<2> &XorEqual(const BigInt<2> &other);
+
+  // consultas y modificación de bits
+  size_t PopCount() const;
+  bool TestBit(size_t n) const;
+  BigInt<2> &SetBit(size_t n);
+  BigInt<2> &ClearBit(size_t n);
+  size_t CountLeadingZeros() const;
+  size_t CountTrailingZeros() const;
 
   // operadores para controlar operaciones
   BigInt<2> FillSign(size_t n) const;
@@ -205,7 +306,6 @@ class BigInt<2> : public Number {
   // extra
   BigInt<2> factorial() const;
   BigInt<2> operator!() const;
-  BigInt<2> operator+=(const BigInt<2> &) const;
 
   // methods overriden from the number class
   Number *add(const Number *) const override;
@@ -213,8 +313,21 @@ class BigInt<2> : public Number {
   Number *multiply(const Number *) const override;
   Number *divide(const Number *) const override;
   Number *module(const Number *) const override;
+  std::pair<Number *, Number *> divmod(const Number *) const override;
   Number *pow(const Number *) const override;
+  Number *powmod(const Number *, const Number *) const override;
+  Number *fact() const override;
+  Number *gcd(const Number *) const override;
+  Number *lcm(const Number *) const override;
+  Number *modinv(const Number *) const override;
+  std::pair<Number *, Number *> xgcd(const Number *) const override;
   Number *addEqual(const Number *) const override;
+  Number *shiftLeft(const Number *) const override;
+  Number *shiftRight(const Number *) const override;
+  Number *bitAnd(const Number *) const override;
+  Number *bitOr(const Number *) const override;
+  Number *bitXor(const Number *) const override;
+  Number *bitNot() const override;
 
   std::ostream &write(std::ostream &) const override;
   std::istream &read(std::istream &)  override;
@@ -223,10 +336,37 @@ class BigInt<2> : public Number {
   ~BigInt() override{}
 
  private:
-  void operator<<(BigInt<2> &other);
-  void operator>>(BigInt<2> &other);
-
-  std::vector<bool> digits;  // dígitos que conforman el número
+  template <size_t Base_t>
+  friend class BigInt;  // las conversiones de BigInt<Base> construyen directamente desde la magnitud
+
+  BigInt(std::vector<uint64_t> &&words, size_t size);
+
+  // acceso y ajuste de las palabras en complemento a 2
+  bool Sign() const;
+  uint64_t Word(size_t) const;
+  void Extend();
+  void Widen(size_t);
+  void Fit(size_t);
+  static void Negate(std::vector<uint64_t> &);
+  static constexpr size_t kMaxShift = static_cast<size_t>(1) << 30;  // mayor desplazamiento a la izquierda
+  static constexpr size_t kMaxFactorial = static_cast<size_t>(1) << 24;  // mayor argumento del factorial
+  size_t ShiftCount(size_t) const;  // valor absoluto como número de posiciones (acotado)
+
+  // núcleo de las operaciones lógicas sobre palabras (AVX2 si está disponible)
+  enum BitwiseOperation { kAnd, kOr, kXor };
+  static void BitwiseWords(uint64_t *, const uint64_t *, uint64_t, size_t, BitwiseOperation);
+  BigInt<2> &Bitwise(const BigInt<2> &, BitwiseOperation);
+  BigInt<2> Reserved(size_t) const;
+
+  // conversión entre la magnitud y limbs de 64 bits, para reutilizar los núcleos de Limbs<2>
+  std::vector<uint64_t> MagnitudeLimbs() const;
+  const uint64_t *Magnitude(std::vector<uint64_t> &, size_t &) const;
+  static BigInt<2> FromMagnitude(std::vector<uint64_t>, bool);
+
+  // bits en palabras de 64 bits (de la menos a la más significativa) en complemento a 2; los bits de la
+  // última palabra por encima de size_ repiten el signo
+  std::vector<uint64_t> words_;
+  size_t size_;  // número de bits del número (incluido el de signo)
 };
 
 #include "../src/bigint.cc"  // se codifica en otro fichero, aunque podría hacerse en este
@@ -22,5 +22,7 @@ private:
 #include "bigintbaddigit.h"
 #include "bigintbasenotimplemented.h"
 #include "bigintdivisionbyzero.h"
+#include "bigintnotinvertible.h"
+#include "bigintoutofrange.h"
 
 #endif // BIGINTEXCEPTION_H
\ No newline at end of file
@@ -0,0 +1,18 @@
+/**
+ * @brief Fichero de cabecera de la clase BigIntNotInvertible que hereda de BigIntException.
+ *
+ */
+
+#ifndef BIGINTNOTINVERTIBLE_H
+#define BIGINTNOTINVERTIBLE_H
+
+#include "bigintexception.h"
+
+class BigIntNotInvertible : public BigIntException
+{
+public:
+    BigIntNotInvertible(const std::string& message) : BigIntException(message) {}
+    const char* what() const throw() { return "Not invertible"; }
+};
+
+#endif // BIGINTNOTINVERTIBLE_H
\ No newline at end of file
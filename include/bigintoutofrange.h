@@ -0,0 +1,18 @@
+/**
+ * @brief Fichero de cabecera de la clase BigIntOutOfRange que hereda de BigIntException.
+ *
+ */
+
+#ifndef BIGINTOUTOFRANGE_H
+#define BIGINTOUTOFRANGE_H
+
+#include "bigintexception.h"
+
+class BigIntOutOfRange : public BigIntException
+{
+public:
+    BigIntOutOfRange(const std::string& message) : BigIntException(message) {}
+    const char* what() const throw() { return "Out of range"; }
+};
+
+#endif // BIGINTOUTOFRANGE_H
\ No newline at end of file
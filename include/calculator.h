@@ -16,6 +16,7 @@
 #include <vector>
 #include <functional>
 #include <typeinfo>
+#include <utility>
 
 #include "number.h"
 #include "bigint.h"
@@ -42,6 +43,8 @@ class Calculator {
   std::map<std::string, T> variables;
   std::map<std::string, std::function<T(T, T)>> operations;
   std::map<std::string, std::function<T(T)>> unary_operations;
+  std::map<std::string, std::function<std::pair<T, T>(T, T)>> pair_operations;  // apilan 2 resultados
+  std::map<std::string, std::function<T(T, T, T)>> ternary_operations;
 
 };
 
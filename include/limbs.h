@@ -0,0 +1,246 @@
+/**
+ * @brief Fichero de cabecera de la clase Limbs. Clase template con las operaciones sobre magnitudes
+ * almacenadas en limbs de 64 bits. Cada limb agrupa k dígitos de la base, es decir, la magnitud se
+ * representa en radix Base^k (por ejemplo 10^19 para base 10 o 16^16 para base 16), del dígito menos
+ * significativo al más significativo. Es el motor de almacenamiento sobre el que se construye BigInt<Base>.
+ *
+ */
+
+#ifndef LIMBS_H
+#define LIMBS_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+template <size_t Base>
+class Limbs {
+ public:
+  typedef uint64_t Limb;
+  typedef unsigned __int128 DoubleLimb;
+  typedef std::vector<Limb> Vector;
+
+  // número de dígitos de la base que caben en un limb y radix (Base^kDigits) de cada limb
+  static constexpr size_t kDigits = [] {
+    size_t digits = 0;
+    DoubleLimb power = 1;
+    while (power * Base <= (static_cast<DoubleLimb>(1) << 64)) {
+      power *= Base;
+      digits++;
+    }
+    return digits;
+  }();
+  static constexpr DoubleLimb kRadix = [] {
+    DoubleLimb power = 1;
+    for (size_t i = 0; i < kDigits; i++) {
+      power *= Base;
+    }
+    return power;
+  }();
+
+  // radix normalizado (bit superior a 1) y su recíproco, para dividir entre el radix multiplicando
+  // (Möller-Granlund) cuando no es una potencia de 2
+  static constexpr int kRadixShift = [] {
+    int shift = 0;
+    for (DoubleLimb value = kRadix; value < (static_cast<DoubleLimb>(1) << 63); value <<= 1) {
+      shift++;
+    }
+    return shift;
+  }();
+  // bits por limb cuando el radix es una potencia de 2 (0 si no lo es)
+  static constexpr unsigned kRadixBits = [] {
+    unsigned bits = 0;
+    if ((kRadix & (kRadix - 1)) == 0) {
+      while ((static_cast<DoubleLimb>(1) << bits) < kRadix) {
+        bits++;
+      }
+    }
+    return bits;
+  }();
+  static constexpr Limb kRadixNormalized = static_cast<Limb>(kRadix << kRadixShift);
+  static constexpr Limb kRadixInverse = kRadixNormalized == 0 ? 0 : static_cast<Limb>(
+      ~static_cast<DoubleLimb>(0) / kRadixNormalized - (static_cast<DoubleLimb>(1) << 64));
+
+  // métodos de comprobación y normalización
+  static void Trim(Vector &);
+  static bool IsZero(const Vector &);
+
+  // vista a nivel de dígito
+  static Limb Power(size_t);
+  static char Digit(const Vector &, size_t);
+  static size_t DigitCount(const Vector &);
+  static Vector FromDigits(const std::vector<char> &);
+  static std::string ToString(const Vector &);
+
+  // lectura y escritura de texto por bloques de 8 caracteres (SWAR, un carácter por byte)
+  static bool FromChars(const char *, size_t, Vector &);
+  static void Format(const Vector &, char *);
+
+  // conversión con la representación binaria (limbs de 64 bits, radix 2^64) y entre bases
+  static Vector FromBinary(const Vector &);
+  static Vector ToBinary(const Vector &);
+  template <size_t From>
+  static Vector Convert(const Vector &);
+  static Vector Regroup(const Vector &, unsigned, unsigned);
+
+  // comparación de magnitudes
+  static int Compare(const Vector &, const Vector &);
+
+  // operaciones aritméticas sobre magnitudes
+  static Vector Add(const Vector &, const Vector &);
+  static Vector Subtract(const Vector &, const Vector &);
+  static Vector Multiply(const Vector &, const Vector &);
+  static Vector Square(const Vector &);
+  static Vector Pow(const Vector &, const Vector &);  // exponente en binario (limbs de 64 bits)
+  static Vector PowMod(const Vector &, const Vector &, const Vector &);  // x^e mod m, e en binario
+  static Vector Factorial(uint64_t);
+  static Vector Gcd(const Vector &, const Vector &);
+  // g = s x + t y, con |s| <= y / 2g; el signo de cada cofactor va en su bool
+  static Vector ExtendedGcd(const Vector &, const Vector &, Vector &, bool &, Vector &, bool &);
+  static void MultiplySmall(Vector &, Limb, Limb);
+  static void Accumulate(Vector &, bool &, const Vector &, bool);
+  static void Increment(Vector &);
+  static void Decrement(Vector &);
+  static Limb DivideSmall(Vector &, Limb);
+  static void ShiftLeft(Vector &, size_t);   // multiplica por Base^n
+  static void ShiftRight(Vector &, size_t);  // divide por Base^n (truncando)
+  static void Divide(const Vector &, const Vector &, Vector &, Vector &);
+  static void DivideBasecase(const Vector &, const Vector &, Vector &, Vector &);
+  static Vector Remainder(const Vector &, const Vector &);  // con los reductores de Barrett en caché
+
+  // umbrales (en limbs del operando menor) a partir de los cuales se usa cada algoritmo
+  static constexpr size_t kKaratsubaThreshold = (kRadix & (kRadix - 1)) == 0 ? 48 : 24;
+  // el cuadrado clásico calcula la mitad de los productos, así que Karatsuba compensa más tarde
+  static constexpr size_t kKaratsubaSquareThreshold = (kRadix & (kRadix - 1)) == 0 ? 64 : 32;
+  static constexpr size_t kToom3Threshold = (kRadix & (kRadix - 1)) == 0 ? 800 : 300;
+  static constexpr size_t kToom4Threshold = (kRadix & (kRadix - 1)) == 0 ? 1280 : 400;
+  static constexpr size_t kNttThreshold = (kRadix & (kRadix - 1)) == 0 ? 1536 : 512;
+  // los selectores prueban los algoritmos de mayor a menor, así que cada umbral debe superar al anterior
+  static_assert(kKaratsubaThreshold < kToom3Threshold && kToom3Threshold < kToom4Threshold &&
+                    kToom4Threshold < kNttThreshold,
+                "los umbrales de multiplicación deben ir en orden creciente");
+  static_assert(kKaratsubaSquareThreshold < kToom3Threshold, "el umbral del cuadrado debe ir antes de Toom-3");
+  // umbral (en limbs del divisor y del cociente) para la división recursiva de Burnikel-Ziegler
+  static constexpr size_t kBurnikelThreshold = (kRadix & (kRadix - 1)) == 0 ? 80 : 30;
+  // umbral (en limbs del módulo) a partir del cual un módulo que se repite se reduce con Barrett
+  static constexpr size_t kBarrettThreshold = 24;
+  // umbral (en limbs) a partir del cual el máximo común divisor usa el half-gcd recursivo
+  static constexpr size_t kHalfGcdThreshold = 96;
+  // umbral (en limbs) por debajo del cual el cambio de base se hace limb a limb
+  static constexpr size_t kConversionThreshold = 32;
+
+  // núcleos sobre punteros: el resultado debe tener espacio para size_x + size_y limbs
+  static void Multiply(Limb *, const Limb *, size_t, const Limb *, size_t);
+  static void MultiplyBasecase(Limb *, const Limb *, size_t, const Limb *, size_t);
+  static void MultiplyKaratsuba(Limb *, const Limb *, size_t, const Limb *, size_t);
+  static void MultiplyToom3(Limb *, const Limb *, size_t, const Limb *, size_t);
+  static void MultiplyToom4(Limb *, const Limb *, size_t, const Limb *, size_t);
+  static void MultiplyNtt(Limb *, const Limb *, size_t, const Limb *, size_t);
+  // cuadrado: el resultado debe tener espacio para 2 * size limbs
+  static void Square(Limb *, const Limb *, size_t);
+  static void SquareBasecase(Limb *, const Limb *, size_t);
+  static void SquareKaratsuba(Limb *, const Limb *, size_t);
+  static Limb AddTo(Limb *, size_t, const Limb *, size_t);
+  static Limb SubtractFrom(Limb *, size_t, const Limb *, size_t);
+
+ private:
+  // entero con signo para los valores intermedios de Toom-Cook (evaluación e interpolación)
+  struct Signed {
+    Vector magnitude;
+    bool negative = false;
+  };
+  static std::vector<Vector> Split(const Limb *, size_t, size_t, size_t);
+  static Signed Evaluate(const std::vector<Vector> &, long);
+  static Signed MultiplySigned(const Signed &, const Signed &);
+  static Signed ProductAt(const std::vector<Vector> &, const std::vector<Vector> &, long, bool);
+  static void AddSigned(Signed &, const Signed &, bool);
+  static void ScaleSigned(Signed &, Limb);
+  static void DivideExact(Signed &, Limb);
+  static void Recompose(Limb *, size_t, const std::vector<Signed> &, size_t);
+  static void DivideRecursive(const Vector &, const Vector &, Vector &, Vector &);
+  static Vector Slice(const Vector &, size_t, size_t);
+
+  static constexpr size_t kChunk = 8;  // caracteres por palabra de 64 bits
+  static bool ParseDigit(char, Limb &);
+  static bool ParseChunk(const char *, Limb &);
+  static bool ParseLimb(const char *, size_t, Limb &);
+  static void FormatChunk(Limb, char *);
+  static void FormatLimb(Limb, size_t, char *);
+
+  // cambio de base divide y vencerás con la tabla de potencias Radix^(2^k) en binario
+  static const std::vector<Vector> &BinaryPowers(size_t);
+  static void FromBinaryRecursive(const Vector &, size_t, Limb *);
+  static Vector ToBinaryRecursive(const Limb *, size_t, size_t);
+
+  // primo de la NTT (p = c * 2^k + 1 < 2^62) con sus constantes de Montgomery (R = 2^64)
+  struct NttPrime {
+    Limb modulus;
+    Limb generator;
+    Limb inverse;  // -p^-1 mod 2^64
+    Limb r2;       // R^2 mod p
+  };
+  static NttPrime MakePrime(Limb, Limb);
+  static Limb MontgomeryReduce(DoubleLimb, const NttPrime &);
+  static Limb MontgomeryMultiply(Limb, Limb, const NttPrime &);
+  static Limb MontgomeryPower(Limb, Limb, const NttPrime &);
+  static Vector Roots(size_t, Limb, const NttPrime &);
+  static void Transform(Vector &, const Vector &, const NttPrime &, bool);
+  static Vector Convolve(const Limb *, size_t, const Limb *, size_t, size_t, const NttPrime &);
+
+  // ventana deslizante de izquierda a derecha sobre los bits de un exponente (en binario, sin ceros por la
+  // izquierda), con el cuadrado y el producto como parámetros
+  template <class SquareOperation, class MultiplyOperation>
+  static Vector SlidingWindow(const Vector &, const Vector &, SquareOperation, MultiplyOperation);
+
+  // factorial por el método de prime-swing: parte impar y producto equilibrado de factores de un limb
+  static Vector OddFactorial(uint64_t, const std::vector<Limb> &);
+  static Vector Product(const Limb *, size_t);
+
+  // máximo común divisor (solo con radix 2^64): pasos de Lehmer sobre los 62 bits superiores, half-gcd
+  // recursivo para operandos grandes y Stein (binario) para terminar en un limb. Matrix acumula los pasos,
+  // de forma que (a', b') = Matrix (a, b)
+  struct Matrix {
+    Signed m00, m01, m10, m11;
+  };
+  static Matrix Identity();
+  static Matrix MultiplyMatrix(const Matrix &, const Matrix &);
+  static void ApplyMatrix(Vector &, Vector &, Matrix &);
+  static void CombineRows(Matrix &, long, long, long, long);
+  static void EuclidReduce(Vector &, Vector &, Matrix *);
+  static void HalfGcd(Vector &, Vector &, Matrix &);
+  static void LehmerStep(Vector &, Vector &, Matrix *);
+  static void EuclidStep(Vector &, Vector &, Matrix *);
+  static Limb BinaryGcd(Limb, Limb);
+
+  // reductor de Barrett: módulo de n limbs y su recíproco floor(R^(2n) / m). Los últimos módulos usados se
+  // guardan en una caché por hilo (como mucho kReducerCacheSize módulos de hasta kBarrettMaxSize limbs); el
+  // recíproco se calcula la segunda vez que aparece un módulo
+  struct Barrett {
+    Vector modulus;
+    Vector reciprocal;
+  };
+  static constexpr size_t kReducerCacheSize = 8;
+  static constexpr size_t kBarrettMaxSize = 16384;
+  static Barrett MakeBarrett(const Vector &);
+  static Vector Reduce(const Vector &, const Barrett &);
+  static const Barrett *CachedBarrett(const Vector &);
+
+  // módulo impar multiprecisión con sus constantes de Montgomery (R = 2^(64 n), solo con radix 2^64); los
+  // valores en forma de Montgomery ocupan siempre n limbs
+  struct Montgomery {
+    Vector modulus;
+    Limb inverse;  // -m^-1 mod 2^64
+  };
+  static Montgomery MakeMontgomery(const Vector &);
+  static Vector ToMontgomery(const Vector &, const Montgomery &);
+  static Vector MontgomeryReduce(Vector &, const Montgomery &);
+  static Vector MontgomeryMultiply(const Vector &, const Vector &, const Montgomery &);
+
+  static Limb SplitRadix(DoubleLimb, Limb &);
+  static Limb DivideNormalized(DoubleLimb, Limb, Limb, int, Limb &);
+  static Limb Reciprocal(Limb);
+};
+
+#include "../src/limbs.cc"  // se codifica en otro fichero, aunque podría hacerse en este
+
+#endif  // LIMBS_H
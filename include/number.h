@@ -9,6 +9,7 @@
 
 #include <iostream>
 #include <string>
+#include <utility>
 
 // forward declaration de las clases template BigInt y BigInt<2>
 template <size_t Base> class BigInt;
@@ -22,8 +23,21 @@ class Number {
   virtual Number* multiply(const Number*) const = 0;
   virtual Number* divide(const Number*) const = 0;
   virtual Number* module(const Number*) const = 0;
+  virtual std::pair<Number*, Number*> divmod(const Number*) const = 0;  // cociente y resto a la vez
   virtual Number* pow(const Number*) const = 0;
+  virtual Number* powmod(const Number*, const Number*) const = 0;  // potencia modular
+  virtual Number* fact() const = 0;  // factorial (no se llama factorial por el de BigInt<2>)
+  virtual Number* gcd(const Number*) const = 0;
+  virtual Number* lcm(const Number*) const = 0;
+  virtual Number* modinv(const Number*) const = 0;  // inverso modular
+  virtual std::pair<Number*, Number*> xgcd(const Number*) const = 0;  // cofactores de Bézout (s, t)
   virtual Number* addEqual(const Number*) const = 0;
+  virtual Number* shiftLeft(const Number*) const = 0;   // multiplica por Base^n
+  virtual Number* shiftRight(const Number*) const = 0;  // divide por Base^n
+  virtual Number* bitAnd(const Number*) const = 0;  // operaciones lógicas en complemento a 2
+  virtual Number* bitOr(const Number*) const = 0;
+  virtual Number* bitXor(const Number*) const = 0;
+  virtual Number* bitNot() const = 0;
 
   // asignación (copia)
   virtual Number& operator=(const Number&) = 0;
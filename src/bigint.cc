@@ -6,10 +6,14 @@
 #ifndef BIGINT_CC
 #define BIGINT_CC
 
+#include <cstring>
 #include <iostream>
 #include <string>
 #include <vector>
 #include <unistd.h>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
 
 #include "..\include\bigint.h"
 
@@ -21,20 +25,11 @@
  */
 template <size_t Base>
 BigInt<Base>::BigInt(long n) {
-  if (n == 0) {
-    sign_ = 1;
-    digits_.push_back(0);
-    return;
-  }
-  if (n < 0) {
-    sign_ = -1;
-    n = -n;
-  } else {
-    sign_ = 1;
-  }
-  while (n > 0) {
-    digits_.push_back(n % Base);
-    n /= Base;
+  unsigned long magnitude = n < 0 ? -static_cast<unsigned long>(n) : n;
+  sign_ = n < 0 ? -1 : 1;
+  while (magnitude > 0) {
+    limbs_.push_back(magnitude % Limbs<Base>::kRadix);
+    magnitude /= Limbs<Base>::kRadix;
   }
 }
 
@@ -46,35 +41,34 @@ BigInt<Base>::BigInt(long n) {
  */
 template <size_t Base>
 BigInt<Base>::BigInt(std::string &number_str) {
+  sign_ = 1;
   if (number_str.empty()) {  // si es vacío (empty)
-    sign_ = 1;
-    digits_.push_back(0);
     return;
   }
-  std::string number_big = number_str;
-  digits_.clear();
-  if (number_big[0] == '-') {
+  size_t begin = 0;
+  if (number_str[0] == '-') {
     sign_ = -1;
-    number_big.erase(0, 1);
-  } else {
-    sign_ = 1;
-  }
-  for (int i = number_big.size() - 1; i >= 0; i--) {
-    if (isdigit(number_big[i])) {
-      if (static_cast<size_t>(number_big[i] - '0') >= Base) {  // si es mayor que la base que representa
+    begin = 1;
+  }
+  // los dígitos se leen por bloques directamente sobre el string; solo si hay un dígito inválido se
+  // recorre de nuevo (desde el menos significativo) para localizarlo y lanzar la excepción
+  if (!Limbs<Base>::FromChars(number_str.data() + begin, number_str.size() - begin, limbs_)) {
+    std::string number_big = number_str.substr(begin);
+    for (int i = number_big.size() - 1; i >= 0; i--) {
+      if (isdigit(number_big[i])) {
+        if (static_cast<size_t>(number_big[i] - '0') >= Base) {  // si es mayor que la base que representa
+          std::string message =
+              "Número mayor que la Base: " + std::to_string(Base) + " con el número " + number_big + " en el dígito " + number_big[i];
+          throw BigIntBaseNotImplemented(message);
+        }
+      } else if (!(number_big[i] >= 'A' && number_big[i] <= 'F' && Base == 16)) {
         std::string message =
-            "Número mayor que la Base: " + std::to_string(Base) + " con el número " + number_big + " en el dígito " + number_big[i];
-        throw BigIntBaseNotImplemented(message);
+            "Bad digit Base: " + std::to_string(Base) + " con el numero " + number_big + " en el digito " + number_big[i];
+        throw BigIntBadDigit(message);
       }
-      digits_.push_back(number_big[i] - '0');
-    } else if (number_big[i] >= 'A' && number_big[i] <= 'F' && Base == 16) {
-      digits_.push_back(number_big[i] - 'A' + 10);
-    } else {
-      std::string message =
-          "Bad digit Base: " + std::to_string(Base) + " con el numero " + number_big + " en el digito " + number_big[i];
-      throw BigIntBadDigit(message);
     }
   }
+  Normalize();
 }
 
 /**
@@ -86,30 +80,33 @@ BigInt<Base>::BigInt(std::string &number_str) {
 template <size_t Base>
 BigInt<Base>::BigInt(const char *number_ptr) {
   size_t size_number = std::char_traits<char>::length(number_ptr);
+  sign_ = 1;
   // Si es vacio
   if (size_number == 0) {
-    sign_ = 1;
-    digits_.push_back(0);
     return;
   }
-  digits_.clear();
   if (number_ptr[0] == '-') {
     sign_ = -1;
     number_ptr++;
     size_number--;
-  } else {
-    sign_ = 1;
   }
-  for (int i = size_number - 1; i >= 0; --i) {
-    if (isdigit(number_ptr[i])) {
-      digits_.push_back(number_ptr[i] - '0');
-    } else if (number_ptr[i] >= 'A' && number_ptr[i] <= 'F') {
-      digits_.push_back(number_ptr[i] - 'A' + 10);
-    } else {
-      std::cout << (int)number_ptr[i] << std::endl;
-      throw std::invalid_argument("Constructor(char): Invalid character");
+  if (!Limbs<Base>::FromChars(number_ptr, size_number, limbs_)) {
+    for (int i = size_number - 1; i >= 0; --i) {
+      char digit;
+      if (isdigit(number_ptr[i])) {
+        digit = number_ptr[i] - '0';
+      } else if (number_ptr[i] >= 'A' && number_ptr[i] <= 'F') {
+        digit = number_ptr[i] - 'A' + 10;
+      } else {
+        std::cout << (int)number_ptr[i] << std::endl;
+        throw std::invalid_argument("Constructor(char): Invalid character");
+      }
+      if (static_cast<size_t>(digit) >= Base) {
+        throw std::invalid_argument("Constructor(char): Invalid digit");
+      }
     }
   }
+  Normalize();
 }
 
 /**
@@ -127,8 +124,62 @@ BigInt<Base>::BigInt(const std::vector<char> &digits_aux, const int &sign_aux) {
       throw std::invalid_argument("Constructor(vector): Invalid digit");
     }
   }
-  digits_ = digits_aux;
+  limbs_ = Limbs<Base>::FromDigits(digits_aux);
+  sign_ = sign_aux;
+  Normalize();
+}
+
+/**
+ * @brief Constructor de BigInt<Base>::BigInt dado un vector de limbs (radix Base^k, del menos al más
+ * significativo) y el signo
+ *
+ * @param Base
+ * @param limbs_aux
+ * @param sign_aux
+ */
+template <size_t Base>
+BigInt<Base>::BigInt(const std::vector<uint64_t> &limbs_aux, int sign_aux) {
+  for (size_t i = 0; i < limbs_aux.size(); i++) {
+    if (limbs_aux[i] >= Limbs<Base>::kRadix) {
+      throw std::invalid_argument("Constructor(limbs): Invalid limb");
+    }
+  }
+  limbs_ = limbs_aux;
+  sign_ = sign_aux;
+  Normalize();
+}
+
+/**
+ * @brief Constructor de BigInt<Base>::BigInt que toma en propiedad un vector de limbs (sin copiarlo)
+ *
+ * @param Base
+ * @param limbs_aux
+ * @param sign_aux
+ */
+template <size_t Base>
+BigInt<Base>::BigInt(std::vector<uint64_t> &&limbs_aux, int sign_aux) {
+  for (size_t i = 0; i < limbs_aux.size(); i++) {
+    if (limbs_aux[i] >= Limbs<Base>::kRadix) {
+      throw std::invalid_argument("Constructor(limbs): Invalid limb");
+    }
+  }
+  limbs_ = std::move(limbs_aux);
   sign_ = sign_aux;
+  Normalize();
+}
+
+/**
+ * @brief Constructor privado para los resultados de Limbs: toma el vector en propiedad sin comprobar cada
+ * limb, ya que los núcleos siempre devuelven limbs menores que el radix
+ *
+ * @param Base
+ * @param limbs_aux
+ * @param sign_aux
+ */
+template <size_t Base>
+BigInt<Base>::BigInt(std::vector<uint64_t> &&limbs_aux, int sign_aux, Unchecked)
+    : limbs_(std::move(limbs_aux)), sign_(sign_aux) {
+  Normalize();
 }
 
 /**
@@ -140,9 +191,19 @@ BigInt<Base>::BigInt(const std::vector<char> &digits_aux, const int &sign_aux) {
 template <size_t Base>
 BigInt<Base>::BigInt(const BigInt<Base> &number_big) {
   sign_ = number_big.sign_;
-  digits_ = number_big.digits_;
+  limbs_ = number_big.limbs_;
 }
 
+/**
+ * @brief Constructor de movimiento de BigInt<Base>::BigInt: se roban los limbs sin reservar memoria
+ *
+ * @param Base
+ * @param number_big
+ */
+template <size_t Base>
+BigInt<Base>::BigInt(BigInt<Base> &&number_big) noexcept
+    : limbs_(std::move(number_big.limbs_)), sign_(number_big.sign_) {}
+
 /**
  * @brief Sobrecarga del operator= para copiar un BigInt
  *
@@ -153,19 +214,35 @@ BigInt<Base>::BigInt(const BigInt<Base> &number_big) {
 template <size_t Base>
 BigInt<Base> &BigInt<Base>::operator=(const BigInt<Base> &number_big) {
   sign_ = number_big.sign_;
-  digits_ = number_big.digits_;
+  limbs_ = number_big.limbs_;
+  return *this;
+}
+
+/**
+ * @brief Asignación por movimiento de un BigInt
+ *
+ * @tparam Base
+ * @param number_big
+ * @return BigInt<Base>&
+ */
+template <size_t Base>
+BigInt<Base> &BigInt<Base>::operator=(BigInt<Base> &&number_big) noexcept {
+  sign_ = number_big.sign_;
+  limbs_ = std::move(number_big.limbs_);
   return *this;
 }
+
 /**
  * @brief Setter del signo del objeto
  *
  * @tparam Base
  * @param sign_aux
- * @return BigInt<Base>
+ * @return BigInt<Base>&
  */
 template <size_t Base>
-BigInt<Base> BigInt<Base>::setSign(int sign_aux) {
+BigInt<Base> &BigInt<Base>::setSign(int sign_aux) {
   sign_ = sign_aux;
+  Normalize();
   return *this;
 }
 
@@ -174,23 +251,39 @@ BigInt<Base> BigInt<Base>::setSign(int sign_aux) {
  *
  * @param Base
  * @param digits_aux
- * @return BigInt<Base>
+ * @return BigInt<Base>&
  */
 template <size_t Base>
-BigInt<Base> BigInt<Base>::setDigits(std::vector<char> digits_aux) {
-  digits_ = digits_aux;
+BigInt<Base> &BigInt<Base>::setDigits(const std::vector<char> &digits_aux) {
+  limbs_ = Limbs<Base>::FromDigits(digits_aux);
+  Normalize();
   return *this;
 }
 
 /**
- * @brief Getter de los dígitos del objeto
+ * @brief Getter de los dígitos del objeto. Se desempaquetan los limbs en un dígito por posición
  *
  * @param Base
  * @return std::vector<char>
  */
 template <size_t Base>
 std::vector<char> BigInt<Base>::getDigits() const {
-  return digits_;
+  std::vector<char> digits_aux(size());
+  for (size_t i = 0; i < digits_aux.size(); i++) {
+    digits_aux[i] = Limbs<Base>::Digit(limbs_, i);
+  }
+  return digits_aux;
+}
+
+/**
+ * @brief Getter de los limbs del objeto (radix Base^k, del menos al más significativo)
+ *
+ * @param Base
+ * @return const std::vector<uint64_t>&
+ */
+template <size_t Base>
+const std::vector<uint64_t> &BigInt<Base>::getLimbs() const {
+  return limbs_;
 }
 
 /**
@@ -205,14 +298,14 @@ int BigInt<Base>::getSign() const {
 }
 
 /**
- * @brief Getter del tamaño del objeto
+ * @brief Getter del tamaño del objeto, en dígitos de la base (el 0 tiene un dígito)
  *
  * @tparam Base
  * @return size_t
  */
 template <size_t Base>
 size_t BigInt<Base>::size() const {
-  return digits_.size();
+  return std::max<size_t>(Limbs<Base>::DigitCount(limbs_), 1);
 }
 
 /**
@@ -225,12 +318,30 @@ size_t BigInt<Base>::size() const {
  */
 template <size_t Base>
 char BigInt<Base>::operator[](size_t position) const {
-  if (position < 0 || position >= digits_.size()) {
-    std::cout << "position: " << position << " Size " << digits_.size()
+  if (position < 0 || position >= size()) {
+    std::cout << "position: " << position << " Size " << size()
               << std::endl;
     throw std::out_of_range("operator[]: Invalid position");
   }
-  return digits_[position];
+  return Limbs<Base>::Digit(limbs_, position);
+}
+
+/**
+ * @brief Compara 2 objetos BigInt sin reservar memoria: primero el signo,
+ * luego el número de limbs y por último los limbs desde el más significativo
+ *
+ * @tparam Base
+ * @param number_y
+ * @return int -1 si es menor, 0 si son iguales y 1 si es mayor
+ */
+template <size_t Base>
+int BigInt<Base>::compare(const BigInt<Base> &number_y) const {
+  // el 0 siempre tiene signo positivo, así que el signo decide sin comprobar si es 0
+  if (sign_ != number_y.sign_) {
+    return sign_ < number_y.sign_ ? -1 : 1;
+  }
+  int comparison = Limbs<Base>::Compare(limbs_, number_y.limbs_);
+  return sign_ < 0 ? -comparison : comparison;
 }
 
 /**
@@ -244,31 +355,7 @@ char BigInt<Base>::operator[](size_t position) const {
  */
 template <size_t Base_t>
 bool operator==(const BigInt<Base_t> &number_x, const BigInt<Base_t> &number_y) {
-  BigInt<Base_t> number_x_aux = number_x;
-  BigInt<Base_t> number_y_aux = number_y;
-  if (number_x_aux.IsZero() && number_y_aux.IsZero()) {
-    return true;
-  }
-  if (number_x.getSign() != number_y.getSign()) {
-    return false;
-  }
-  if (number_x.getDigits().size() != number_y.getDigits().size()) {
-    // se completa con ceros
-    size_t size_difference =
-        std::abs(static_cast<int>(number_x.getDigits().size()) - static_cast<int>(number_y.getDigits().size()));
-    if (number_x.getDigits().size() > number_y.getDigits().size()) {
-      number_y_aux = number_y_aux.FillZeros(size_difference);
-    } else if (number_x.getDigits().size() < number_y.getDigits().size()) {
-      number_x_aux = number_x_aux.FillZeros(size_difference);
-    }
-  }
-
-  for (size_t i = 0; i < number_x_aux.size(); i++) {
-    if (number_x_aux[i] != number_y_aux[i]) {
-      return false;
-    }
-  }
-  return true;
+  return number_x.compare(number_y) == 0;
 }
 
 /**
@@ -281,7 +368,7 @@ bool operator==(const BigInt<Base_t> &number_x, const BigInt<Base_t> &number_y)
  */
 template <size_t Base>
 bool BigInt<Base>::operator!=(const BigInt<Base> &number_y) const {
-  return !(*this == number_y);
+  return compare(number_y) != 0;
 }
 
 /**
@@ -295,34 +382,7 @@ bool BigInt<Base>::operator!=(const BigInt<Base> &number_y) const {
  */
 template <size_t Base_t>
 bool operator>(const BigInt<Base_t> &number_x, const BigInt<Base_t> &number_y) {
-  if (number_x.getSign() > number_y.getSign()) {
-    return true;
-  } else if (number_x.getSign() < number_y.getSign()) {
-    return false;
-  }
-  size_t number_digit_different =
-      abs(number_x.getDigits().size() - number_y.getDigits().size());
-  BigInt<Base_t> number_y_aux;
-  BigInt<Base_t> number_x_aux;
-  if (number_x.getDigits().size() > number_y.getDigits().size()) {
-    number_y_aux = number_y.FillZeros(number_digit_different);
-    number_x_aux = number_x;
-  } else if (number_x.getDigits().size() < number_y.getDigits().size()) {
-    number_x_aux = number_x.FillZeros(number_digit_different);
-    number_y_aux = number_y;
-  } else {
-    number_x_aux = number_x;
-    number_y_aux = number_y;
-  }
-
-  for (int i = number_x_aux.getDigits().size() - 1; i >= 0; i--) {
-    if (number_x_aux.getDigits()[i] > number_y_aux.getDigits()[i]) {
-      return number_x_aux.getSign() == 1 ? true : false;
-    } else if (number_x_aux.getDigits()[i] < number_y_aux.getDigits()[i]) {
-      return number_x_aux.getSign() == 1 ? false : true;
-    }
-  }
-  return false;
+  return number_x.compare(number_y) > 0;
 }
 
 /**
@@ -335,7 +395,7 @@ bool operator>(const BigInt<Base_t> &number_x, const BigInt<Base_t> &number_y) {
  */
 template <size_t Base>
 bool BigInt<Base>::operator>=(const BigInt<Base> &number_y) const {
-  return (*this > number_y || *this == number_y);
+  return compare(number_y) >= 0;
 }
 
 /**
@@ -349,7 +409,7 @@ bool BigInt<Base>::operator>=(const BigInt<Base> &number_y) const {
  */
 template <size_t Base_t>
 bool operator<(const BigInt<Base_t> &number_x, const BigInt<Base_t> &number_y) {
-  return !(number_x >= number_y);
+  return number_x.compare(number_y) < 0;
 }
 
 /**
@@ -362,8 +422,22 @@ bool operator<(const BigInt<Base_t> &number_x, const BigInt<Base_t> &number_y) {
  */
 template <size_t Base>
 bool BigInt<Base>::operator<=(const BigInt<Base> &number_y) const {
-  return !(*this > number_y);
+  return compare(number_y) <= 0;
+}
+
+#if __cplusplus >= 202002L
+/**
+ * @brief Comparación a tres bandas (C++20)
+ *
+ * @tparam Base
+ * @param number_y
+ * @return std::strong_ordering
+ */
+template <size_t Base>
+std::strong_ordering BigInt<Base>::operator<=>(const BigInt<Base> &number_y) const {
+  return compare(number_y) <=> 0;
 }
+#endif
 
 /**
  * @brief Comprueba que un objeto BigInt sea 0
@@ -374,16 +448,36 @@ bool BigInt<Base>::operator<=(const BigInt<Base> &number_y) const {
  */
 template <size_t Base>
 bool BigInt<Base>::IsZero() const {
-  for (size_t i = 0; i < digits_.size(); i++) {
-    if (digits_[i] != 0) {
-      return false;
-    }
-  }
-  return true;
+  return limbs_.empty();
+}
+
+/**
+ * @brief Comprueba que un objeto BigInt sea negativo (el 0 nunca lo es)
+ *
+ * @tparam Base
+ * @return true
+ * @return false
+ */
+template <size_t Base>
+bool BigInt<Base>::IsNegative() const {
+  return sign_ == -1;
 }
 
 /**
- * @brief Inserta ceros al comienzo del BigInt
+ * @brief Restablece el invariante de la representación: elimina los limbs a 0 por la izquierda,
+ * deja el signo en 1 o -1 y hace que el 0 sea siempre positivo
+ *
+ * @tparam Base
+ */
+template <size_t Base>
+void BigInt<Base>::Normalize() {
+  Limbs<Base>::Trim(limbs_);
+  sign_ = (sign_ < 0 && !limbs_.empty()) ? -1 : 1;
+}
+
+/**
+ * @brief Inserta ceros al comienzo del BigInt. Los limbs no almacenan ceros a la izquierda, por lo
+ * que el valor no cambia y se devuelve una copia
  *
  * @tparam Base
  * @param number_zero
@@ -391,9 +485,7 @@ bool BigInt<Base>::IsZero() const {
  */
 template <size_t Base>
 BigInt<Base> BigInt<Base>::FillZeros(unsigned number_zero) const {
-  std::string number_str = this->to_string();
-  number_str.insert(number_str.begin(), number_zero, '0');
-  return BigInt<Base>(number_str);
+  return *this;
 }
 
 /**
@@ -418,17 +510,13 @@ BigInt<Base> BigInt<Base>::Abs() const {
  */
 template <size_t Base>
 std::string BigInt<Base>::to_string() const {
-  std::string number_str;
-  if (sign_ == -1) {
-    number_str += '-';
-  }
-  for (int i = digits_.size() - 1; i >= 0; i--) {
-    if (digits_[i] < 10) {
-      number_str += digits_[i] + '0';
-    } else {
-      number_str += digits_[i] - 10 + 'A';
-    }
+  if (limbs_.empty()) {
+    return "0";
   }
+  // se reserva el tamaño exacto (signo incluido) y los dígitos se escriben directamente en el buffer
+  size_t offset = sign_ == -1 ? 1 : 0;
+  std::string number_str(Limbs<Base>::DigitCount(limbs_) + offset, '-');
+  Limbs<Base>::Format(limbs_, &number_str[offset]);
   return number_str;
 }
 
@@ -456,41 +544,17 @@ BigInt<Base> BigInt<Base>::operator-() const {
 template <size_t Base_t>
 BigInt<Base_t> operator+(const BigInt<Base_t> &number_x,
                          const BigInt<Base_t> &number_y) {
-  int carry = 0;
-  size_t number_digit_different =
-      abs(number_x.getDigits().size() - number_y.getDigits().size());
-  BigInt<Base_t> number_y_aux;
-  BigInt<Base_t> number_x_aux;
-  if (number_x.getDigits().size() > number_y.getDigits().size()) {
-    number_y_aux = number_y.FillZeros(number_digit_different);
-    number_x_aux = number_x;
-  } else if (number_x.getDigits().size() < number_y.getDigits().size()) {
-    number_x_aux = number_x.FillZeros(number_digit_different);
-    number_y_aux = number_y;
-  } else {
-    number_x_aux = number_x;
-    number_y_aux = number_y;
-  }
-
-  // se controla el signo del resultado de los operandos debido a que es definido por el mayor
-  if (number_x_aux.getSign() != number_y_aux.getSign()) {
-    if (number_x_aux.getSign() == -1) {
-      return number_y_aux - (-number_x_aux);
-    } else {
-      return number_x_aux - (-number_y_aux);
+  // con signos distintos se resta la magnitud menor de la mayor y el signo es el del mayor en magnitud
+  if (number_x.getSign() != number_y.getSign()) {
+    if (Limbs<Base_t>::Compare(number_x.getLimbs(), number_y.getLimbs()) < 0) {
+      return BigInt<Base_t>(Limbs<Base_t>::Subtract(number_y.limbs_, number_x.limbs_), number_y.sign_,
+                            BigInt<Base_t>::kUnchecked);
     }
+    return BigInt<Base_t>(Limbs<Base_t>::Subtract(number_x.limbs_, number_y.limbs_), number_x.sign_,
+                          BigInt<Base_t>::kUnchecked);
   }
 
-  std::vector<char> digits_sum;
-  for (size_t i = 0; i < number_x_aux.getDigits().size(); i++) {
-    int sum = number_x_aux[i] + number_y_aux[i] + carry;
-    digits_sum.push_back(sum % Base_t);
-    carry = sum / Base_t;
-  }
-  if (carry != 0) {
-    digits_sum.push_back(carry);
-  }
-  return BigInt<Base_t>(digits_sum, number_x_aux.getSign());
+  return BigInt<Base_t>(Limbs<Base_t>::Add(number_x.limbs_, number_y.limbs_), number_x.sign_, BigInt<Base_t>::kUnchecked);
 }
 
 /**
@@ -502,47 +566,15 @@ BigInt<Base_t> operator+(const BigInt<Base_t> &number_x,
  */
 template <size_t Base>
 BigInt<Base> BigInt<Base>::operator-(const BigInt<Base> &number_y) const {
-  size_t number_digit_different =
-      abs(this->getDigits().size() - number_y.getDigits().size());
-  BigInt<Base> number_y_aux;
-  BigInt<Base> number_x_aux;
-  if (this->getDigits().size() > number_y.getDigits().size()) {
-    number_y_aux = number_y.FillZeros(number_digit_different);
-    number_x_aux = *this;
-  } else if (this->getDigits().size() < number_y.getDigits().size()) {
-    number_x_aux = this->FillZeros(number_digit_different);
-    number_y_aux = number_y;
-  } else {
-    number_x_aux = *this;
-    number_y_aux = number_y;
-  }
-  // solo para los números positivos y number_x_aux > number_y_aux podemos controlar siempre esta situación
-
-  if (number_x_aux < number_y_aux) {
-    return BigInt<Base>(number_y_aux - number_x_aux).setSign(-1);
-  }
-  if (number_x_aux.getSign() == 1 && number_y_aux.getSign() == -1) {
-    return BigInt<Base>(number_x_aux + (-number_y_aux));
-  } else if (number_x_aux.getSign() == -1 && number_y_aux.getSign() == 1) {
-    return BigInt<Base>((-number_x_aux) + number_y_aux);
-  } else if (number_x_aux.getSign() == -1 && number_y_aux.getSign() == -1) {
-    return BigInt<Base>(number_x_aux + (-number_y_aux));
+  // con signos distintos la resta es una suma de magnitudes con el signo del minuendo
+  if (sign_ != number_y.sign_) {
+    return BigInt<Base>(Limbs<Base>::Add(limbs_, number_y.limbs_), sign_, kUnchecked);
   }
-
-  std::vector<char> digits_sub;
-  int carry = 0;
-  for (size_t i = 0; i < number_x_aux.size(); i++) {
-    int sub = number_x_aux[i] - number_y_aux[i] - carry;
-    if (sub < 0) {
-      sub += Base;
-      carry = 1;
-    } else {
-      carry = 0;
-    }
-    digits_sub.push_back(sub);
+  // con el mismo signo se resta la magnitud menor de la mayor
+  if (Limbs<Base>::Compare(limbs_, number_y.limbs_) < 0) {
+    return BigInt<Base>(Limbs<Base>::Subtract(number_y.limbs_, limbs_), -sign_, kUnchecked);
   }
-
-  return BigInt<Base>(digits_sub, number_x_aux.getSign());
+  return BigInt<Base>(Limbs<Base>::Subtract(limbs_, number_y.limbs_), sign_, kUnchecked);
 }
 
 /**
@@ -550,24 +582,32 @@ BigInt<Base> BigInt<Base>::operator-(const BigInt<Base> &number_y) const {
  *
  * @tparam Base
  * @param number_aux
- * @return BigInt<Base>
+ * @return BigInt<Base>&
  */
 template <size_t Base>
-BigInt<Base> BigInt<Base>::PushBack(char number_aux) {
-  digits_.push_back(static_cast<char>(number_aux));
+BigInt<Base> &BigInt<Base>::PushBack(char number_aux) {
+  size_t position = size();
+  limbs_.resize(std::max(limbs_.size(), position / Limbs<Base>::kDigits + 1), 0);
+  limbs_[position / Limbs<Base>::kDigits] += number_aux * Limbs<Base>::Power(position % Limbs<Base>::kDigits);
+  Normalize();
   return *this;
 }
 
 /**
- * @brief Incrementa el objeto BigInt en 1 unidad (pre-incremento)
+ * @brief Incrementa el objeto BigInt en 1 unidad (pre-incremento). Se modifica la magnitud en el lugar
+ * y el acarreo se detiene en el primer limb que no desborda
  *
  * @tparam Base
  * @return BigInt<Base>&
  */
 template <size_t Base>
 BigInt<Base> &BigInt<Base>::operator++() {
-  BigInt<Base> One(1);
-  *this = *this + One;
+  if (sign_ == -1) {
+    Limbs<Base>::Decrement(limbs_);
+    Normalize();
+  } else {
+    Limbs<Base>::Increment(limbs_);
+  }
   return *this;
 }
 
@@ -579,22 +619,28 @@ BigInt<Base> &BigInt<Base>::operator++() {
  */
 template <size_t Base>
 BigInt<Base> BigInt<Base>::operator++(int) {
-  BigInt<Base> One(1);
   BigInt<Base> number_aux = *this;
-  *this = *this + One;
+  ++(*this);
   return number_aux;
 }
 
 /**
- * @brief Decrementa el objeto BigInt en 1 unidad (pre-decremento)
+ * @brief Decrementa el objeto BigInt en 1 unidad (pre-decremento). Se modifica la magnitud en el lugar
+ * y el préstamo se detiene en el primer limb no nulo
  *
  * @tparam Base
  * @return BigInt<Base>&
  */
 template <size_t Base>
 BigInt<Base> &BigInt<Base>::operator--() {
-  BigInt<Base> One(1);
-  *this = *this - One;
+  if (sign_ == -1) {
+    Limbs<Base>::Increment(limbs_);
+  } else if (limbs_.empty()) {
+    limbs_.push_back(1);
+    sign_ = -1;
+  } else {
+    Limbs<Base>::Decrement(limbs_);
+  }
   return *this;
 }
 
@@ -607,9 +653,7 @@ BigInt<Base> &BigInt<Base>::operator--() {
 template <size_t Base>
 BigInt<Base> BigInt<Base>::operator--(int) {
   BigInt<Base> number_aux = *this;
-  BigInt<Base> One(1);
-
-  *this = *this - One;
+  --(*this);
   return number_aux;
 }
 
@@ -622,26 +666,12 @@ BigInt<Base> BigInt<Base>::operator--(int) {
  */
 template <size_t Base>
 BigInt<Base> BigInt<Base>::operator*(const BigInt<Base> &number_y) const {
-  size_t n = this->getDigits().size();
-  size_t m = number_y.getDigits().size();
-  std::vector<char> product(n + m, 0);
-
   if (this->IsZero() || number_y.IsZero()) {
     BigInt<Base> zero;
     return zero;
   }
-  for (size_t i = 0; i < n; i++) {
-    int carry = 0;
-    for (size_t j = 0; j < m; j++) {
-      int tmp = digits_[i] * number_y.digits_[j] + product[i + j] + carry;
-      carry = tmp / Base;
-      product[i + j] = (tmp % Base);
-    }
-    product[i + m] = (carry);
-  }
-  while (product.size() > 1 && product.back() == 0) product.pop_back();
   int sign = (this->getSign() == number_y.getSign()) ? 1 : -1;
-  return BigInt(product, sign);
+  return BigInt(Limbs<Base>::Multiply(limbs_, number_y.limbs_), sign, kUnchecked);
 }
 
 /**
@@ -655,97 +685,203 @@ BigInt<Base> BigInt<Base>::operator*(const BigInt<Base> &number_y) const {
 template <size_t Base>
 BigInt<Base> operator/(const BigInt<Base> &number_x,
                        const BigInt<Base> &number_y) {
-  BigInt<Base> a = number_x;
-  BigInt<Base> b = number_y;
-  if (b.IsZero()) {
+  return number_x.DivMod(number_y).first;
+}
+
+/**
+ * @brief Módulo entre 2 objetos BigInt. El resto tiene el signo del dividendo. Solo se calcula el resto, con
+ * Limbs::Remainder, que reutiliza el reductor de Barrett del divisor si se ha usado hace poco
+ *
+ * @tparam Base
+ * @param number_y
+ * @return BigInt<Base>
+ */
+template <size_t Base>
+BigInt<Base> BigInt<Base>::operator%(const BigInt<Base> &number_y) const {
+  if (number_y.IsZero()) {
+    std::string error_message = "Division by zero";
+    throw BigIntDivisionByZero(error_message);
+  }
+  return BigInt<Base>(Limbs<Base>::Remainder(limbs_, number_y.limbs_), sign_, kUnchecked);
+}
+
+/**
+ * @brief Calcula el cociente y el resto de la división con una sola pasada de Limbs::Divide. La división
+ * es truncada: el cociente se redondea hacia 0 y el resto tiene el signo del dividendo
+ *
+ * @tparam Base
+ * @param number_y
+ * @return std::pair<BigInt<Base>, BigInt<Base>>
+ */
+template <size_t Base>
+std::pair<BigInt<Base>, BigInt<Base>> BigInt<Base>::DivMod(const BigInt<Base> &number_y) const {
+  if (number_y.IsZero()) {
     std::string error_message = "Division by zero";
     throw BigIntDivisionByZero(error_message);
   }
+  std::vector<uint64_t> quotient, remainder;
+  Limbs<Base>::Divide(limbs_, number_y.limbs_, quotient, remainder);
+  int sign = sign_ == number_y.sign_ ? 1 : -1;
+  return std::make_pair(BigInt<Base>(std::move(quotient), sign, kUnchecked),
+                        BigInt<Base>(std::move(remainder), sign_, kUnchecked));
+}
 
-  if (a < b) {
+/**
+ * @brief Función para calcular la potencia de un número. Las bases triviales se resuelven sin multiplicar
+ * (0, ±1 y las potencias de la base, que son un desplazamiento de dígitos); el resto se eleva con la
+ * ventana deslizante de Limbs, que lee los bits del exponente directamente. Un exponente negativo da 0
+ * 
+ * @tparam Base
+ * @param number_x
+ * @param number_y
+ * @return BigInt<Base> 
+ * @throw BigIntOutOfRange si una potencia de la base supera kMaxShift dígitos
+ */
+template <size_t Base>
+BigInt<Base> pow(const BigInt<Base> &number_x, const BigInt<Base> &number_y) {
+  const std::vector<uint64_t> &limbs_x = number_x.getLimbs();
+  const std::vector<uint64_t> &limbs_y = number_y.getLimbs();
+  if (number_y.IsNegative()) {
     return BigInt<Base>();
   }
-  if (a == b) {
+  if (number_y.IsZero()) {
     return BigInt<Base>(1);
   }
-  long i, lgcat = 0, cc;
-  long n = a.getDigits().size();
-  std::vector<char> cat(n, 0);
-  BigInt<Base> t;
-  BigInt<Base> aux_base(Base);
-  for (i = n - 1; i >= 0 && (t * aux_base) + BigInt<Base>(a[i]) < b; i--) {
-    t = t * aux_base;
-    t = t + BigInt<Base>((int)a[i]);
+  if (number_x.IsZero()) {
+    return BigInt<Base>();
   }
-  for (; i >= 0; i--) {
-    t = (t * Base) + BigInt<Base>((int)a[i]);
-    for (cc = Base - 1; b * cc > t; cc--)
-      ;
-    t = t - (b * cc);
-    cat[lgcat++] = cc;
+  // el radix es par, así que la paridad del exponente es la de su limb menos significativo
+  int sign = number_x.IsNegative() && (limbs_y[0] & 1) != 0 ? -1 : 1;
+  // |x| = Base^digits (un 1 seguido de ceros): x^y es un desplazamiento de digits * y dígitos
+  size_t top = limbs_x.size() - 1;
+  size_t digits = 0;
+  bool power = std::all_of(limbs_x.begin(), limbs_x.begin() + top, [](uint64_t limb) { return limb == 0; });
+  for (uint64_t limb = limbs_x[top]; power && limb != 1; limb /= Base, digits++) {
+    power = limb % Base == 0;
+  }
+  if (power) {
+    size_t positions = top * Limbs<Base>::kDigits + digits;
+    size_t shift = 0;
+    if (positions != 0 && (limbs_y.size() > 1 || __builtin_mul_overflow(positions, limbs_y[0], &shift) ||
+                           shift > BigInt<Base>::kMaxShift)) {
+      throw BigIntOutOfRange("Power out of range");
+    }
+    BigInt<Base> result(sign);
+    result <<= shift;
+    return result;
   }
+  return BigInt<Base>(Limbs<Base>::Pow(limbs_x, Limbs<Base>::ToBinary(limbs_y)), sign, BigInt<Base>::kUnchecked);
+}
 
-  std::vector<char> result(cat.size(), 0);
-
-  for (i = 0; i < lgcat; i++) result[i] = cat[lgcat - i - 1];
-  int sign = (a.getSign() == b.getSign()) ? 1 : -1;
-
-  // se limpia el resultado
-  while (result.size() > 1 && result.back() == 0) result.pop_back();
+/**
+ * @brief Potencia de un BigInt (Por ejemplo: 5^2)
+ *
+ * @tparam Base
+ * @param number_y
+ * @return BigInt<Base>
+ */
+template <size_t Base>
+BigInt<Base> BigInt<Base>::operator^(const BigInt<Base> &number_y) const {
+  return ::pow(*this, number_y);
+}
 
-  BigInt<Base> r(result, sign);
-  return r;
+/**
+ * @brief Potencia modular: (*this)^exponent mod modulus sin construir la potencia, con la exponenciación de
+ * Montgomery de Limbs. El resultado es el de (*this ^ exponent) % modulus: tiene el signo de la potencia
+ * (el resto toma el signo del dividendo) y un exponente negativo da 0
+ *
+ * @tparam Base
+ * @param exponent
+ * @param modulus
+ * @return BigInt<Base>
+ */
+template <size_t Base>
+BigInt<Base> BigInt<Base>::PowMod(const BigInt<Base> &exponent, const BigInt<Base> &modulus) const {
+  if (modulus.IsZero()) {
+    std::string error_message = "Division by zero";
+    throw BigIntDivisionByZero(error_message);
+  }
+  if (exponent.IsNegative()) {
+    return BigInt<Base>();
+  }
+  int sign = sign_ == -1 && !exponent.IsZero() && (exponent.limbs_[0] & 1) != 0 ? -1 : 1;
+  std::vector<uint64_t> bits = Limbs<Base>::ToBinary(exponent.limbs_);
+  return BigInt<Base>(Limbs<Base>::PowMod(limbs_, bits, modulus.limbs_), sign, kUnchecked);
 }
 
 /**
- * @brief Módulo entre 2 objetos BigInt
+ * @brief Máximo común divisor de los valores absolutos (Lehmer y half-gcd de Limbs). gcd(0, 0) es 0
  *
  * @tparam Base
  * @param number_y
  * @return BigInt<Base>
  */
 template <size_t Base>
-BigInt<Base> BigInt<Base>::operator%(const BigInt<Base> &number_y) const {
-  return *this - (((*this / number_y).Abs()) * number_y);
+BigInt<Base> BigInt<Base>::Gcd(const BigInt<Base> &number_y) const {
+  return BigInt<Base>(Limbs<Base>::Gcd(limbs_, number_y.limbs_), 1, kUnchecked);
 }
 
 /**
- * @brief Función para calcular la potencia de un número
- * 
+ * @brief Máximo común divisor g con los cofactores de Bézout: g = s * (*this) + t * number_y. El signo de
+ * cada cofactor sigue al de su operando y |s| <= |number_y| / 2g
+ *
  * @tparam Base
- * @param number_x
  * @param number_y
- * @return BigInt<Base> 
+ * @param s
+ * @param t
+ * @return BigInt<Base>
  */
 template <size_t Base>
-BigInt<Base> pow(const BigInt<Base> &number_x, const BigInt<Base> &number_y) {
-  static BigInt<Base> zero;
-  static BigInt<Base> one(1);
-  static BigInt<Base> two(2);
-  if (number_y < zero) {
-    return zero;
+BigInt<Base> BigInt<Base>::ExtendedGcd(const BigInt<Base> &number_y, BigInt<Base> &s, BigInt<Base> &t) const {
+  std::vector<uint64_t> s_limbs, t_limbs;
+  bool s_negative, t_negative;
+  std::vector<uint64_t> gcd = Limbs<Base>::ExtendedGcd(limbs_, number_y.limbs_, s_limbs, s_negative, t_limbs,
+                                                       t_negative);
+  s = BigInt<Base>(std::move(s_limbs), s_negative != (sign_ == -1) ? -1 : 1, kUnchecked);
+  t = BigInt<Base>(std::move(t_limbs), t_negative != (number_y.sign_ == -1) ? -1 : 1, kUnchecked);
+  return BigInt<Base>(std::move(gcd), 1, kUnchecked);
+}
+
+/**
+ * @brief Inverso de *this módulo modulus, en [0, |modulus|). Solo existe si el mcd es 1
+ *
+ * @tparam Base
+ * @param modulus
+ * @return BigInt<Base>
+ */
+template <size_t Base>
+BigInt<Base> BigInt<Base>::ModInverse(const BigInt<Base> &modulus) const {
+  if (modulus.IsZero()) {
+    std::string error_message = "Division by zero";
+    throw BigIntDivisionByZero(error_message);
   }
-  if (number_y == zero) {
-    return one;
-  } else if (number_y % two == zero) {
-    BigInt<Base> half = pow(number_x, number_y / two);
-    return half * half;
-  } else {
-    BigInt<Base> half = pow(number_x, (number_y - one) / two);
-    return half * half * number_x;
+  BigInt<Base> s, t;
+  BigInt<Base> gcd = ExtendedGcd(modulus, s, t);
+  if (gcd.limbs_.size() != 1 || gcd.limbs_[0] != 1) {
+    std::string error_message = "Not invertible";
+    throw BigIntNotInvertible(error_message);
+  }
+  if (s.IsNegative()) {
+    s += modulus.Abs();
   }
+  return s;
 }
 
 /**
- * @brief Potencia de un BigInt (Por ejemplo: 5^2)
+ * @brief Mínimo común múltiplo de los valores absolutos: |x| / gcd * |y|. Es 0 si algún operando lo es
  *
  * @tparam Base
  * @param number_y
  * @return BigInt<Base>
  */
 template <size_t Base>
-BigInt<Base> BigInt<Base>::operator^(const BigInt<Base> &number_y) const {
-  return ::pow(*this, number_y);
+BigInt<Base> BigInt<Base>::Lcm(const BigInt<Base> &number_y) const {
+  if (IsZero() || number_y.IsZero()) {
+    return BigInt<Base>();
+  }
+  std::vector<uint64_t> quotient, remainder;
+  Limbs<Base>::Divide(limbs_, Limbs<Base>::Gcd(limbs_, number_y.limbs_), quotient, remainder);
+  return BigInt<Base>(Limbs<Base>::Multiply(quotient, number_y.limbs_), 1, kUnchecked);
 }
 
 /**
@@ -779,39 +915,162 @@ std::istream &operator>>(std::istream &input, BigInt<Base_t> &number_x) {
 }
 
 /**
- * @brief Operador para calcular el factorial de un número
+ * @brief Operador para calcular el factorial de un número (del valor absoluto si es negativo), con el
+ * prime-swing de Limbs::Factorial
  * 
  * @tparam Base_t
  * @return BigInt<Base> 
+ * @throw BigIntOutOfRange si el valor absoluto supera kMaxFactorial
  */
 template <size_t Base>
 BigInt<Base> BigInt<Base>::operator!() const {
-  BigInt<Base> number_aux = this->Abs();
-  BigInt<Base> result("1");
-  BigInt<Base> i("1");
-  BigInt<Base> zero("0");
-  if (number_aux == zero) {
-    return result;
-  }
-  for (; i <= number_aux; ++i) {
-    result = result * i;
-  }
-  return result;
+  return BigInt<Base>(Limbs<Base>::Factorial(ShiftCount(kMaxFactorial)), 1, kUnchecked);
 }
 
 /**
- * @brief Operador para calcular la suma acumulando el resultado a la izquierda de la igualdad
- * 
- * @tparam Base_t
+ * @brief Suma en el lugar: la magnitud del operando izquierdo se actualiza sobre su propio vector de limbs
+ *
+ * @tparam Base
  * @param number_y
- * @return BigInt<Base> 
+ * @return BigInt<Base>&
  */
 template <size_t Base>
-BigInt<Base> BigInt<Base>::operator+=(const BigInt<Base> &number_y) const {
-  BigInt<Base> aux = *this;
-  BigInt<Base> other = number_y;
-  //return *this = *this + number_y;
-  return aux = aux + other;
+BigInt<Base> &BigInt<Base>::operator+=(const BigInt<Base> &number_y) {
+  bool negative = sign_ == -1;
+  Limbs<Base>::Accumulate(limbs_, negative, number_y.limbs_, number_y.sign_ == -1);
+  sign_ = negative ? -1 : 1;
+  Normalize();
+  return *this;
+}
+
+/**
+ * @brief Resta en el lugar
+ *
+ * @tparam Base
+ * @param number_y
+ * @return BigInt<Base>&
+ */
+template <size_t Base>
+BigInt<Base> &BigInt<Base>::operator-=(const BigInt<Base> &number_y) {
+  bool negative = sign_ == -1;
+  Limbs<Base>::Accumulate(limbs_, negative, number_y.limbs_, number_y.sign_ != -1);
+  sign_ = negative ? -1 : 1;
+  Normalize();
+  return *this;
+}
+
+/**
+ * @brief Multiplicación con asignación. El producto necesita un vector propio, que pasa a ser el del objeto
+ *
+ * @tparam Base
+ * @param number_y
+ * @return BigInt<Base>&
+ */
+template <size_t Base>
+BigInt<Base> &BigInt<Base>::operator*=(const BigInt<Base> &number_y) {
+  limbs_ = Limbs<Base>::Multiply(limbs_, number_y.limbs_);
+  sign_ = sign_ == number_y.sign_ ? 1 : -1;
+  Normalize();
+  return *this;
+}
+
+/**
+ * @brief División con asignación
+ *
+ * @tparam Base
+ * @param number_y
+ * @return BigInt<Base>&
+ */
+template <size_t Base>
+BigInt<Base> &BigInt<Base>::operator/=(const BigInt<Base> &number_y) {
+  *this = DivMod(number_y).first;
+  return *this;
+}
+
+/**
+ * @brief Módulo con asignación
+ *
+ * @tparam Base
+ * @param number_y
+ * @return BigInt<Base>&
+ */
+template <size_t Base>
+BigInt<Base> &BigInt<Base>::operator%=(const BigInt<Base> &number_y) {
+  *this = *this % number_y;
+  return *this;
+}
+
+/**
+ * @brief Desplaza el número n dígitos a la izquierda en el lugar (multiplica por Base^n): los limbs
+ * completos se insertan como ceros de una vez y el resto de dígitos se aplica con Limbs::ShiftLeft
+ *
+ * @tparam Base
+ * @param n
+ * @return BigInt<Base>&
+ */
+template <size_t Base>
+BigInt<Base> &BigInt<Base>::operator<<=(size_t n) {
+  Limbs<Base>::ShiftLeft(limbs_, n);
+  return *this;
+}
+
+/**
+ * @brief Desplaza el número n dígitos a la derecha en el lugar (divide por Base^n). Se descartan los
+ * dígitos menos significativos de la magnitud, así que trunca hacia 0 igual que operator/
+ *
+ * @tparam Base
+ * @param n
+ * @return BigInt<Base>&
+ */
+template <size_t Base>
+BigInt<Base> &BigInt<Base>::operator>>=(size_t n) {
+  Limbs<Base>::ShiftRight(limbs_, n);
+  Normalize();
+  return *this;
+}
+
+/**
+ * @brief Devuelve el número desplazado n dígitos a la izquierda (multiplicado por Base^n)
+ *
+ * @tparam Base
+ * @param n
+ * @return BigInt<Base>
+ */
+template <size_t Base>
+BigInt<Base> BigInt<Base>::operator<<(size_t n) const {
+  BigInt<Base> result(*this);
+  result <<= n;
+  return result;
+}
+
+/**
+ * @brief Devuelve el número desplazado n dígitos a la derecha (dividido por Base^n truncando)
+ *
+ * @tparam Base
+ * @param n
+ * @return BigInt<Base>
+ */
+template <size_t Base>
+BigInt<Base> BigInt<Base>::operator>>(size_t n) const {
+  BigInt<Base> result(*this);
+  result >>= n;
+  return result;
+}
+
+/**
+ * @brief Valor absoluto del número como cantidad de posiciones (de un desplazamiento o del factorial)
+ *
+ * @tparam Base
+ * @param limit mayor cantidad admitida
+ * @return size_t
+ * @throw BigIntOutOfRange si el valor absoluto supera limit
+ */
+template <size_t Base>
+size_t BigInt<Base>::ShiftCount(size_t limit) const {
+  if (limbs_.size() > 1 || (!limbs_.empty() && limbs_[0] > limit)) {
+    throw BigIntOutOfRange("Count out of range");
+  }
+  return limbs_.empty() ? 0 : limbs_[0];
 }
 
 /**
@@ -822,42 +1081,19 @@ BigInt<Base> BigInt<Base>::operator+=(const BigInt<Base> &number_y) const {
  */
 template <size_t Base>
 BigInt<Base>::operator BigInt<2>() const {
-  BigInt<Base> number_aux = this->Abs();
-  BigInt<Base> zero;
-  BigInt<Base> two(2);
-  std::vector<bool> result;
-  if (number_aux == zero) {
-    result.push_back(false);
-    result.push_back(0);
-    return BigInt<2>(result);
-  }
-  while (number_aux != zero) {
-    result.push_back(number_aux % two == zero ? false : true);
-    number_aux = number_aux / two;
-  }
-  // se debe añadir el signo
-  result.push_back(0);
-  if (this->getSign() == -1) {
-    BigInt<2> aux(result);
-    return -aux;
-  }
-
-  BigInt<2> aux(result);
-  return aux;
+  return BigInt<2>::FromMagnitude(Limbs<Base>::ToBinary(limbs_), sign_ == -1);
 }
 
 /**
- * @brief Operador de cambio de tipo de BigInt a BigInt<8>
+ * @brief Operador de cambio de tipo de BigInt a BigInt<8>. Desde las bases 8 y 16 se reagrupan los bits;
+ * desde el resto, la magnitud pasa por binario con el cambio de base divide y vencerás de Limbs
  * 
  * @tparam Base 
  * @return BigInt<8> 
  */
 template <size_t Base>
 BigInt<Base>::operator BigInt<8>() const {
-  BigInt<Base> aux = *this;
-  BigInt<2> aux2 = aux;
-  BigInt<8> result = aux2.ConvertBaseT<8>();
-  return result;
+  return BigInt<8>(Limbs<8>::template Convert<Base>(limbs_), sign_, BigInt<8>::kUnchecked);
 }
 
 /**
@@ -868,10 +1104,7 @@ BigInt<Base>::operator BigInt<8>() const {
  */
 template <size_t Base>
 BigInt<Base>::operator BigInt<10>() const {
-  BigInt<Base> aux = *this;
-  BigInt<2> aux2 = aux;
-  BigInt<10> result = aux2.ConvertBaseT<10>();
-  return result;
+  return BigInt<10>(Limbs<10>::template Convert<Base>(limbs_), sign_, BigInt<10>::kUnchecked);
 }
 
 /**
@@ -882,10 +1115,7 @@ BigInt<Base>::operator BigInt<10>() const {
  */
 template <size_t Base>
 BigInt<Base>::operator BigInt<16>() const {
-  BigInt<Base> aux = *this;
-  BigInt<2> aux2 = aux;
-  BigInt<16> result = aux2.ConvertBaseT<16>();
-  return result;
+  return BigInt<16>(Limbs<16>::template Convert<Base>(limbs_), sign_, BigInt<16>::kUnchecked);
 }
 
 // Methods overrided from Number
@@ -985,6 +1215,25 @@ Number *BigInt<Base>::module(const Number *otherNum) const {
   return result;
 }
 
+/**
+ * @brief Realiza la división de los números BigInt<Base> y devuelve a la vez el cociente y el resto
+ *
+ * @tparam Base
+ * @param otherNum
+ * @return std::pair<Number *, Number *>
+ */
+template <size_t Base>
+std::pair<Number *, Number *> BigInt<Base>::divmod(const Number *otherNum) const {
+  const BigInt *other = dynamic_cast<const BigInt *>(otherNum);
+  std::pair<BigInt<Base>, BigInt<Base>> result;
+  if (other == nullptr) {
+    result = DivMod(BigInt<Base>(*otherNum));
+  } else {
+    result = DivMod(*other);
+  }
+  return std::make_pair(new BigInt<Base>(std::move(result.first)), new BigInt<Base>(std::move(result.second)));
+}
+
 /**
  * @brief Realiza la potencia de los números BigInt<Base>
  *
@@ -1004,6 +1253,130 @@ Number *BigInt<Base>::pow(const Number *otherNum) const {
   return result;
 }
 
+/**
+ * @brief Realiza la potencia modular de los números BigInt<Base>
+ *
+ * @tparam Base
+ * @param exponentNum
+ * @param modulusNum
+ * @return Number*
+ */
+template <size_t Base>
+Number *BigInt<Base>::powmod(const Number *exponentNum, const Number *modulusNum) const {
+  return new BigInt<Base>(PowMod(static_cast<BigInt<Base>>(*exponentNum), static_cast<BigInt<Base>>(*modulusNum)));
+}
+
+/**
+ * @brief Calcula el factorial del número BigInt<Base>
+ *
+ * @tparam Base
+ * @return Number*
+ */
+template <size_t Base>
+Number *BigInt<Base>::fact() const {
+  return new BigInt<Base>(!*this);
+}
+
+/**
+ * @brief Calcula el máximo común divisor de los números BigInt<Base>
+ *
+ * @tparam Base
+ * @param otherNum
+ * @return Number*
+ */
+template <size_t Base>
+Number *BigInt<Base>::gcd(const Number *otherNum) const {
+  return new BigInt<Base>(Gcd(static_cast<BigInt<Base>>(*otherNum)));
+}
+
+/**
+ * @brief Calcula el mínimo común múltiplo de los números BigInt<Base>
+ *
+ * @tparam Base
+ * @param otherNum
+ * @return Number*
+ */
+template <size_t Base>
+Number *BigInt<Base>::lcm(const Number *otherNum) const {
+  return new BigInt<Base>(Lcm(static_cast<BigInt<Base>>(*otherNum)));
+}
+
+/**
+ * @brief Calcula el inverso modular del número BigInt<Base>
+ *
+ * @tparam Base
+ * @param modulusNum
+ * @return Number*
+ */
+template <size_t Base>
+Number *BigInt<Base>::modinv(const Number *modulusNum) const {
+  return new BigInt<Base>(ModInverse(static_cast<BigInt<Base>>(*modulusNum)));
+}
+
+/**
+ * @brief Calcula los cofactores de Bézout (s, t) de los números BigInt<Base>
+ *
+ * @tparam Base
+ * @param otherNum
+ * @return std::pair<Number *, Number *>
+ */
+template <size_t Base>
+std::pair<Number *, Number *> BigInt<Base>::xgcd(const Number *otherNum) const {
+  BigInt<Base> s, t;
+  ExtendedGcd(static_cast<BigInt<Base>>(*otherNum), s, t);
+  return std::make_pair(new BigInt<Base>(std::move(s)), new BigInt<Base>(std::move(t)));
+}
+
+/**
+ * @brief AND bit a bit de los números BigInt<Base>. Los operandos se pasan a complemento a 2 (BigInt<2>),
+ * se operan por palabras y el resultado vuelve a la base del número
+ *
+ * @tparam Base
+ * @param otherNum
+ * @return Number*
+ */
+template <size_t Base>
+Number *BigInt<Base>::bitAnd(const Number *otherNum) const {
+  return new BigInt<Base>(static_cast<BigInt<2>>(*this) & static_cast<BigInt<2>>(*otherNum));
+}
+
+/**
+ * @brief OR bit a bit de los números BigInt<Base>, en complemento a 2 como bitAnd
+ *
+ * @tparam Base
+ * @param otherNum
+ * @return Number*
+ */
+template <size_t Base>
+Number *BigInt<Base>::bitOr(const Number *otherNum) const {
+  return new BigInt<Base>(static_cast<BigInt<2>>(*this) | static_cast<BigInt<2>>(*otherNum));
+}
+
+/**
+ * @brief XOR bit a bit de los números BigInt<Base>, en complemento a 2 como bitAnd
+ *
+ * @tparam Base
+ * @param otherNum
+ * @return Number*
+ */
+template <size_t Base>
+Number *BigInt<Base>::bitXor(const Number *otherNum) const {
+  return new BigInt<Base>(static_cast<BigInt<2>>(*this).Xor(static_cast<BigInt<2>>(*otherNum)));
+}
+
+/**
+ * @brief NOT bit a bit del número BigInt<Base>: en complemento a 2, ~x = -x - 1
+ *
+ * @tparam Base
+ * @return Number*
+ */
+template <size_t Base>
+Number *BigInt<Base>::bitNot() const {
+  BigInt<Base> *result = new BigInt<Base>(-*this);
+  --*result;
+  return result;
+}
+
 /**
  * @brief Realiza la suma de los números BigInt<Base> acumulando el resultado
  *
@@ -1013,13 +1386,57 @@ Number *BigInt<Base>::pow(const Number *otherNum) const {
  */
 template <size_t Base>
 Number *BigInt<Base>::addEqual(const Number *otherNum) const {
+  // el resultado es un objeto nuevo (las variables de la calculadora no se modifican), pero la suma se
+  // hace en el lugar sobre él, sin copias intermedias de los operandos
   const BigInt *other = dynamic_cast<const BigInt *>(otherNum);
+  BigInt<Base> *result = new BigInt<Base>(*this);
   if (other == nullptr) {
-    other = new BigInt<Base>(*otherNum);
-    return new BigInt<Base>(this->operator+=(*other));
+    *result += BigInt<Base>(*otherNum);
+  } else {
+    *result += *other;
+  }
+  return result;
+}
+
+/**
+ * @brief Desplaza el número tantos dígitos a la izquierda como indique otherNum (multiplica por
+ * Base^otherNum)
+ *
+ * @tparam Base
+ * @param otherNum
+ * @return Number*
+ * @throw BigIntOutOfRange si otherNum es negativo o supera kMaxShift
+ */
+template <size_t Base>
+Number *BigInt<Base>::shiftLeft(const Number *otherNum) const {
+  const BigInt *other = dynamic_cast<const BigInt *>(otherNum);
+  BigInt<Base> count = other == nullptr ? BigInt<Base>(*otherNum) : *other;
+  if (count.IsNegative()) {
+    throw BigIntOutOfRange("Negative shift count");
   }
+  BigInt<Base> *result = new BigInt<Base>(*this);
+  *result <<= count.ShiftCount(kMaxShift);
+  return result;
+}
 
-  BigInt<Base> *result = new BigInt<Base>(this->operator+=(*other));
+/**
+ * @brief Desplaza el número tantos dígitos a la derecha como indique otherNum (divide por Base^otherNum
+ * truncando). Un desplazamiento mayor que el número de dígitos da 0
+ *
+ * @tparam Base
+ * @param otherNum
+ * @return Number*
+ * @throw BigIntOutOfRange si otherNum es negativo o no cabe en size_t
+ */
+template <size_t Base>
+Number *BigInt<Base>::shiftRight(const Number *otherNum) const {
+  const BigInt *other = dynamic_cast<const BigInt *>(otherNum);
+  BigInt<Base> count = other == nullptr ? BigInt<Base>(*otherNum) : *other;
+  if (count.IsNegative()) {
+    throw BigIntOutOfRange("Negative shift count");
+  }
+  BigInt<Base> *result = new BigInt<Base>(*this);
+  *result >>= count.ShiftCount(static_cast<size_t>(-1));
   return result;
 }
 
@@ -1088,25 +1505,12 @@ Number& BigInt<Base>::operator=(const Number& otherNum) {
  * @param number_x
  */
 BigInt<2>::BigInt(long number_x) {
-  bool sign = false;  // se inicializa el signo
-  if (number_x < 0) {
-    sign = true;
-    number_x = -number_x;
-  }
-  if (number_x == 0) {  // // si el número es 0, pasa a ser 00
-    digits.push_back(0);
-    digits.push_back(0);
-  }
-
-  while (number_x > 0) {
-    digits.push_back(number_x % 2);
-    number_x /= 2;
-  }
-  digits.push_back(0);
-
-  if (sign) {  // si el número es negativo
-    *this = -*this;  
-    }
+  // magnitud sin signo (válida también para LONG_MIN); el ancho es el de la magnitud más el bit de signo
+  uint64_t magnitude = number_x < 0 ? -static_cast<uint64_t>(number_x) : static_cast<uint64_t>(number_x);
+  size_ = magnitude == 0 ? 3 : 65 - __builtin_clzll(magnitude);  // si el número es 0, pasa a ser 000
+  words_.assign((size_ + 63) / 64, number_x < 0 ? ~static_cast<uint64_t>(0) : 0);
+  words_[0] = number_x < 0 ? -magnitude : magnitude;
+  Extend();
 }
 
 /**
@@ -1114,8 +1518,8 @@ BigInt<2>::BigInt(long number_x) {
  *
  * @param digits
  */
-BigInt<2>::BigInt(std::vector<bool> digits) {
-  this->digits = digits;
+BigInt<2>::BigInt(const std::vector<bool> &digits) : size_(0) {
+  setDigits(digits);
 }
 
 /**
@@ -1123,8 +1527,26 @@ BigInt<2>::BigInt(std::vector<bool> digits) {
  *
  * @param number_x
  */
-BigInt<2>::BigInt(const BigInt<2> &number_x) {
-  digits = number_x.digits;
+BigInt<2>::BigInt(const BigInt<2> &number_x) : words_(number_x.words_), size_(number_x.size_) {}
+
+/**
+ * @brief Constructor de movimiento de BigInt<2>::BigInt
+ *
+ * @param number_x
+ */
+BigInt<2>::BigInt(BigInt<2> &&number_x) noexcept
+    : words_(std::move(number_x.words_)), size_(number_x.size_) {}
+
+/**
+ * @brief Constructor privado a partir de palabras ya empaquetadas en complemento a 2 y su número de bits.
+ * Se ajusta el número de palabras al tamaño y se extiende el signo en la última
+ *
+ * @param words
+ * @param size
+ */
+BigInt<2>::BigInt(std::vector<uint64_t> &&words, size_t size) : words_(std::move(words)), size_(size) {
+  words_.resize((size_ + 63) / 64);
+  Extend();
 }
 
 /**
@@ -1132,34 +1554,48 @@ BigInt<2>::BigInt(const BigInt<2> &number_x) {
  *
  * @param number_x
  */
-BigInt<2>::BigInt(std::string number_x) {
+BigInt<2>::BigInt(std::string number_x) : size_(0) {
   if (number_x.size() == 0) {  // si el tamaño es 0, pasa a ser 00
-    digits.push_back(0);
-    digits.push_back(0);
-  }
-  if (number_x.size() == 1) {  // si el tamaño es 1, error porque debe ser 00 o 01 como mínimo
-    if (number_x[0] == '0') {
-      digits.push_back(0);
-      digits.push_back(0);
-    } else if (number_x[0] == '1') {
-      digits.push_back(1);
-      digits.push_back(1);
-    } else {
-      std::string message = "Error bad digit: " + number_x[0];
+    setDigits(std::vector<bool>(2, false));
+    return;
+  }
+  if (number_x.size() == 1) {  // si el tamaño es 1, el dígito se repite: 0 pasa a ser 000 y 1 pasa a ser 111
+    if (number_x[0] != '0' && number_x[0] != '1') {
+      std::string message = std::string("Error bad digit: ") + number_x[0];
       throw BigIntBadDigit(message);
     }
+    setDigits(std::vector<bool>(3, number_x[0] == '1'));
+    return;
+  }
+  size_ = number_x.size();
+  words_.assign((size_ + 63) / 64, 0);
+  const char *end = number_x.data() + size_;
+  size_t bit = 0;
+  // bloques de 8 caracteres desde el final (un carácter por byte): se validan a la vez comprobando que
+  // todos los bytes sean 0x30 o 0x31, y el producto lleva el bit bajo de cada byte al byte superior con
+  // el primer carácter en el bit más significativo
+  for (; bit + 8 <= size_; bit += 8) {
+    uint64_t chunk;
+    std::memcpy(&chunk, end - bit - 8, 8);
+    if ((chunk & ~0x0101010101010101ULL) != 0x3030303030303030ULL) {
+      break;  // el bloque se vuelve a recorrer carácter a carácter para informar del dígito erróneo
+    }
+    uint64_t byte = ((chunk & 0x0101010101010101ULL) * 0x8040201008040201ULL) >> 56;
+    words_[bit / 64] |= byte << (bit % 64);
   }
-  for (int i = number_x.size() - 1; i >= 0; i--) {
-    if (number_x[i] != '0' && number_x[i] != '1') {  // el número debe ser 0 o 1
-     std::string message = "Error bad digit: " + number_x[i];
-     throw BigIntBadDigit (message);
+  for (; bit < size_; bit++) {
+    char digit = end[-1 - static_cast<long>(bit)];
+    if (digit != '0' && digit != '1') {  // el número debe ser 0 o 1
+      std::string message = std::string("Error bad digit: ") + digit;
+      throw BigIntBadDigit(message);
     }
-    digits.push_back(number_x[i] - '0');
+    words_[bit / 64] |= static_cast<uint64_t>(digit - '0') << (bit % 64);
   }
+  Extend();
 }
 
 // Constructor necesario para llevar a cabo el cambio de tipo de BigInt<2> a BigInt<Base>
-BigInt<2>::BigInt(const std::vector<char> &digits_aux,const int &sign ){
+BigInt<2>::BigInt(const std::vector<char> &digits_aux,const int &sign ) : size_(0) {
 std::cerr << "Constructor en base 2\n";
 }
 
@@ -1171,7 +1607,7 @@ std::cerr << "Constructor en base 2\n";
  * @return false
  */
 bool BigInt<2>::operator[](size_t n) const {
-  return digits[n];
+  return (Word(n / 64) >> (n % 64)) & 1;
 }
 
 /**
@@ -1180,17 +1616,30 @@ bool BigInt<2>::operator[](size_t n) const {
  * @return size_t
  */
 size_t BigInt<2>::size() const {
-  return digits.size();
+  return size_;
 }
 
 /**
  * @brief Sobrecarga del operator= para copiar un BigInt<2>
  *
  * @param other
- * @return BigInt<2>
+ * @return BigInt<2>&
+ */
+BigInt<2> &BigInt<2>::operator=(const BigInt<2> &other) {
+  words_ = other.words_;
+  size_ = other.size_;
+  return *this;
+}
+
+/**
+ * @brief Asignación por movimiento de un BigInt<2>
+ *
+ * @param other
+ * @return BigInt<2>&
  */
-BigInt<2> BigInt<2>::operator=(const BigInt<2> &other) {
-  digits = other.digits;
+BigInt<2> &BigInt<2>::operator=(BigInt<2> &&other) noexcept {
+  words_ = std::move(other.words_);
+  size_ = other.size_;
   return *this;
 }
 
@@ -1200,33 +1649,72 @@ BigInt<2> BigInt<2>::operator=(const BigInt<2> &other) {
  * @return std::string
  */
 std::string BigInt<2>::to_string() const {
-  std::string number_x;
-  for (int i = digits.size() - 1; i >= 0; i--) {
-    number_x += digits[i] + '0';
+  std::string number_x(size_, '0');
+  for (size_t i = 0; i < size_; i++) {
+    if ((words_[i / 64] >> (i % 64)) & 1) {
+      number_x[size_ - 1 - i] = '1';
+    }
   }
   return number_x;
 }
 
 /**
- * @brief Método para obtener los dígitos de un objeto
+ * @brief Método para obtener los dígitos de un objeto. Es una vista desempaquetada: construye un vector
+ * nuevo a partir de las palabras
  *
- * @return size_t
+ * @return std::vector<bool>
  */
 std::vector<bool> BigInt<2>::getDigits() const {
+  std::vector<bool> digits(size_);
+  for (size_t i = 0; i < size_; i++) {
+    digits[i] = (*this)[i];
+  }
   return digits;
 }
 
 /**
- * @brief Método para asignar los dígitos de un objeto
+ * @brief Método para asignar los dígitos de un objeto. Los bits se empaquetan en palabras de 64 bits
  *
- * @param n
- * @return BigInt<2>
+ * @param digits
+ * @return BigInt<2>&
  */
-BigInt<2> BigInt<2>::setDigits(std::vector<bool> digits) {
-  this->digits = digits;
+BigInt<2> &BigInt<2>::setDigits(const std::vector<bool> &digits) {
+  size_ = digits.size();
+  words_.assign((size_ + 63) / 64, 0);
+  for (size_t i = 0; i < size_; i++) {
+    if (digits[i]) {
+      words_[i / 64] |= static_cast<uint64_t>(1) << (i % 64);
+    }
+  }
+  Extend();
   return *this;
 }
 
+/**
+ * @brief Compara 2 objetos BigInt<2> sin reservar memoria. Si los bits de signo difieren decide el
+ * signo; si coinciden, el número más corto se extiende con su palabra de signo de forma implícita y se
+ * comparan las palabras sin signo desde la más significativa (en complemento a 2 con el mismo signo el
+ * orden coincide)
+ *
+ * @param other
+ * @return int -1 si es menor, 0 si son iguales y 1 si es mayor
+ */
+int BigInt<2>::compare(const BigInt<2> &other) const {
+  bool sign_x = Sign();
+  bool sign_y = other.Sign();
+  if (sign_x != sign_y) {
+    return sign_x ? -1 : 1;
+  }
+  for (size_t i = std::max(words_.size(), other.words_.size()); i > 0; i--) {
+    uint64_t word_x = Word(i - 1);
+    uint64_t word_y = other.Word(i - 1);
+    if (word_x != word_y) {
+      return word_x < word_y ? -1 : 1;
+    }
+  }
+  return 0;
+}
+
 /**
  * @brief Comprueba que 2 objetos BigInt<2> sean equivalentes
  *
@@ -1235,25 +1723,7 @@ BigInt<2> BigInt<2>::setDigits(std::vector<bool> digits) {
  * @return false
  */
 bool operator==(const BigInt<2> &first, const BigInt<2> &other) {
-  BigInt<2> number_x;
-  BigInt<2> number_y;
-  // se rellena con el signo para evitar casos como: 0000001 = 01 -> false
-  if (first.size() < other.digits.size()) {
-    number_x = first.FillSign(other.digits.size() - first.size());
-    number_y = other;
-  } else if (first.size() > other.digits.size()) {
-    number_x = first;
-    number_y = other.FillSign(first.size() - other.digits.size());
-  }else{
-    number_x = first;
-    number_y = other;
-  }
-  for (size_t i = 0; i < number_x.digits.size(); i++) {
-    if (number_x.digits[i] != number_y.digits[i]) {
-      return false;
-    }
-  }
-  return true;
+  return first.compare(other) == 0;
 }
 
 /**
@@ -1264,7 +1734,7 @@ bool operator==(const BigInt<2> &first, const BigInt<2> &other) {
  * @return false
  */
 bool BigInt<2>::operator!=(const BigInt<2> &other) const {
-  return !(*this == other);
+  return compare(other) != 0;
 }
 
 /**
@@ -1275,39 +1745,7 @@ bool BigInt<2>::operator!=(const BigInt<2> &other) const {
  * @return false
  */
 bool operator>(const BigInt<2> &first, const BigInt<2> &other) {
-  // se rellena con el signo para evitar casos como: 0000001 = 01 -> false
-  // caso en el que tienen signo distinto
-  if (first[first.size() - 1] < other.digits[other.digits.size() - 1]) {
-    return true;
-  } else if (first[first.size() - 1] > other.digits[other.digits.size() - 1]) {
-    return false;
-  }
-  // caso en el que tienen el mismo signo
-  bool sign = first[first.size() - 1];
-  BigInt<2> number_x;
-  BigInt<2> number_y;
-  if (sign) {
-    number_x = first.Abs();
-    number_y = other.Abs();
-  } else {
-    number_x = first;
-    number_y = other;
-  }
-  if (number_x.digits.size() > number_y.digits.size()) {
-    number_y =
-        number_y.FillSign(number_x.digits.size() - number_y.digits.size());
-  } else if (number_x.digits.size() < number_y.digits.size()) {
-    number_x =
-        number_x.FillSign(number_y.digits.size() - number_x.digits.size());
-  }
-  for (long long i = number_x.digits.size() - 1; i >= 0; i--) {
-    if (number_x.digits[i] > number_y.digits[i]) {
-      return sign ? false : true;
-    } else if (number_x.digits[i] < number_y.digits[i]) {
-      return sign ? true : false;
-    }
-  }
-  return false;
+  return first.compare(other) > 0;
 }
 
 /**
@@ -1318,7 +1756,7 @@ bool operator>(const BigInt<2> &first, const BigInt<2> &other) {
  * @return false
  */
 bool operator<(const BigInt<2> &first, const BigInt<2> &other) {
-  return !(first > other || first == other);
+  return first.compare(other) < 0;
 }
 
 /**
@@ -1329,7 +1767,7 @@ bool operator<(const BigInt<2> &first, const BigInt<2> &other) {
  * @return false
  */
 bool BigInt<2>::operator>=(const BigInt<2> &other) const {
-  return !(*this < other);
+  return compare(other) >= 0;
 }
 
 /**
@@ -1340,37 +1778,20 @@ bool BigInt<2>::operator>=(const BigInt<2> &other) const {
  * @return false
  */
 bool BigInt<2>::operator<=(const BigInt<2> &other) const {
-  return !(*this > other);
-}
-
-/**
- * @brief Desplazamiento en base a n (a la izquierda)
- *
- * @param n
- */
-void BigInt<2>::operator<<(size_t n) {
-  std::vector<bool> aux;
-  aux.insert(aux.begin(), digits.begin(), digits.end() - n);
-  aux.insert(aux.end(), n, digits[digits.size() - 1]);
-  digits = aux;
+  return compare(other) <= 0;
 }
 
+#if __cplusplus >= 202002L
 /**
- * @brief Desplazamiento en base a n (a la derecha)
+ * @brief Comparación a tres bandas (C++20)
  *
- * @param n
+ * @param other
+ * @return std::strong_ordering
  */
-void BigInt<2>::operator>>(size_t n) {
-  if (n > digits.size()) {
-    digits.clear();
-    digits.push_back(0);
-    return;
-  }
-  std::vector<bool> aux;
-  aux.insert(aux.begin(), n, digits[digits.size() - 1]);
-  aux.insert(aux.end(), digits.begin() + n, digits.end());
-  digits = aux;
+std::strong_ordering BigInt<2>::operator<=>(const BigInt<2> &other) const {
+  return compare(other) <=> 0;
 }
+#endif
 
 /**
  * @brief Realiza la suma de 2 objetos BigInt<2>
@@ -1380,173 +1801,238 @@ void BigInt<2>::operator>>(size_t n) {
  * @return BigInt<2>
  */
 BigInt<2> operator+(const BigInt<2> &first, const BigInt<2> &other) {
-  std::vector<bool> number_x = first.digits;
-  std::vector<bool> number_y = other.digits;
-  bool carry = false;
-  bool sum;
-  
-  // se añaden ceros al número más pequeño (por la izquierda) por posibles overflows
-  if (number_x.size() > number_y.size()) {
-    number_y = other.FillSign(number_x.size() - number_y.size()).digits;
-  } else if (number_x.size() < number_y.size()) {
-    number_x = first.FillSign(number_y.size() - number_x.size()).digits;
-  }
-  std::vector<bool> aux;
-  for (size_t i = 0; i < number_x.size(); i++) {
-    sum = number_x[i] ^ number_y[i] ^ carry;
-    carry = (number_x[i] & number_y[i]) | (number_x[i] & carry) |
-            (number_y[i] & carry);
-    aux.push_back(sum);
-  }
-  
-  // posible caso de overflow si el signo es igual
-  if (!(first[first.size() - 1] != other[other.size() - 1])) {
-    if (aux[aux.size() - 1] != first[first.size() - 1]) {  // overflow
-      aux.push_back(first[first.size() - 1]);
-    }
-  }
-
-  BigInt<2> result(aux);
+  // se reserva de una vez el tamaño del mayor más una palabra para el desbordamiento y se suma en el lugar
+  std::vector<uint64_t> words;
+  words.reserve(std::max(first.words_.size(), other.words_.size()) + 1);
+  words.assign(first.words_.begin(), first.words_.end());
+  BigInt<2> result(std::move(words), first.size_);
+  result += other;
   return result;
 }
 
 /**
- * @brief Realiza la suma de 2 objetos BigInt<2> con overflow
+ * @brief Realiza la resta de 2 objetos BigInt<2>
  *
- * @param first
  * @param other
  * @return BigInt<2>
  */
-BigInt<2> BigInt<2>::suma_overflow(const BigInt<2> &first, const BigInt<2> &other) const {
-  std::vector<bool> number_x = first.digits;
-  std::vector<bool> number_y = other.digits;
-  bool carry = false;
-  bool sum;
-  
-  // se añaden ceros al número más pequeño (por la izquierda) por posibles overflows
-  if (number_x.size() > number_y.size()) {
-    number_y = other.FillSign(number_x.size() - number_y.size()).digits;
-  } else if (number_x.size() < number_y.size()) {
-    number_x = first.FillSign(number_y.size() - number_x.size()).digits;
-  }
-
-  std::vector<bool> aux;
-  for (size_t i = 0; i < number_x.size(); i++) {
-    sum = number_x[i] ^ number_y[i] ^ carry;
-    carry = (number_x[i] & number_y[i]) | (number_x[i] & carry) |
-            (number_y[i] & carry);
-    aux.push_back(sum);
-  }
-  BigInt<2> result(aux);
+BigInt<2> BigInt<2>::operator-(const BigInt<2> &other) const {
+  std::vector<uint64_t> words;
+  words.reserve(std::max(words_.size(), other.words_.size()) + 1);
+  words.assign(words_.begin(), words_.end());
+  BigInt<2> result(std::move(words), size_);
+  result -= other;
   return result;
 }
 
 /**
- * @brief Realiza la resta de 2 objetos BigInt<2>
+ * @brief Inserta un dígito al comienzo de un BigInt<2>
  *
- * @param other
- * @return BigInt<2>
+ * @param digit
  */
-BigInt<2> BigInt<2>::operator-(const BigInt<2> &other) const {
-  BigInt<2> number_y = other.ComplementoA2();
-  BigInt<2> result = *this + number_y;
-  return result;
+void BigInt<2>::push_back(bool digit) {
+  // por ejemplo: example 011.push_back(1) = 1011
+  uint64_t mask = static_cast<uint64_t>(1) << (size_ % 64);
+  words_.resize(size_ / 64 + 1, Sign() ? ~static_cast<uint64_t>(0) : 0);
+  words_.back() = digit ? words_.back() | mask : words_.back() & ~mask;
+  size_++;
+  Extend();
 }
 
 /**
- * @brief Sobrecarga el operator>> para cambiar la posición hacia la derecha a BigInt<2> 
+ * @brief Multiplica 2 objetos BigInt<2> sobre palabras de 64 bits con el selector de Limbs<2> (schoolbook,
+ * Karatsuba, Toom-Cook o NTT según el tamaño). Los operandos positivos se multiplican directamente desde
+ * sus palabras; el signo se aplica al final en complemento a 2 sobre el propio producto
  *
  * @param other
+ * @return BigInt<2>
  */
-void BigInt<2>::operator>>(BigInt<2> &other) {
-  // Example 0001 >> 1001 = 0100 1100
-  std::vector<bool> aux;
-  aux.insert(aux.end(), digits.begin(), digits.end() - 1);
-  aux.insert(aux.begin(), digits[0]);
-  std::vector<bool> aux2;
-  aux2.insert(aux2.end(), other.digits.begin(), other.digits.end() - 1);
-  aux2.insert(aux2.begin(), digits[digits.size() - 1]);
-  this->setDigits(aux);
-  other.setDigits(aux2);
+BigInt<2> BigInt<2>::operator*(const BigInt<2> &other) const {
+  std::vector<uint64_t> buffer_x, buffer_y;
+  size_t size_x, size_y = 0;
+  const uint64_t *number_x = this->Magnitude(buffer_x, size_x);
+  // si los operandos son el mismo se comparte la magnitud para que Limbs<2> haga un cuadrado
+  const uint64_t *number_y = this == &other ? number_x : other.Magnitude(buffer_y, size_y);
+  if (this == &other) {
+    size_y = size_x;
+  }
+  if (size_x == 0 || size_y == 0) {
+    return FromMagnitude(std::vector<uint64_t>(), false);
+  }
+  // una palabra más para que el bit de signo quepa sin volver a reservar
+  std::vector<uint64_t> product(size_x + size_y + 1, 0);
+  Limbs<2>::Multiply(product.data(), number_x, size_x, number_y, size_y);
+  return FromMagnitude(std::move(product), Sign() != other.Sign());
 }
 
 /**
- * @brief Sobrecarga el operator<< para cambiar la posición hacia la izquierda a BigInt<2>
+ * @brief Devuelve la magnitud del número en limbs de 64 bits, del menos al más significativo
  *
- * @param other
+ * @return std::vector<uint64_t>
  */
-void BigInt<2>::operator<<(BigInt<2> &other) {
-  // Example 0110 << 0100 = 1100 1000
-  std::vector<bool> aux;
-  aux.insert(aux.end(), digits.begin() + 1, digits.end());
-  aux.push_back(other.digits[0]);
-  std::vector<bool> aux2;
-  aux2.insert(aux2.end(), other.digits.begin() + 1, other.digits.end());
-  aux2.push_back(other.digits[other.digits.size() - 1]);
-  this->setDigits(aux);
-  other.setDigits(aux2);
+std::vector<uint64_t> BigInt<2>::MagnitudeLimbs() const {
+  // las palabras ya son limbs de 64 bits con el signo extendido: basta con negarlas si es negativo
+  std::vector<uint64_t> limbs(words_);
+  if (Sign()) {
+    Negate(limbs);
+  }
+  Limbs<2>::Trim(limbs);
+  return limbs;
 }
 
 /**
- * @brief Inserta un dígito al comienzo de un BigInt<2>
+ * @brief Vista de la magnitud en limbs de 64 bits sin ceros por la izquierda. Si el número es positivo
+ * apunta a sus propias palabras; si es negativo, la magnitud se escribe negada en buffer
  *
- * @param digit
+ * @param buffer
+ * @param size número de limbs de la magnitud
+ * @return const uint64_t*
  */
-void BigInt<2>::push_back(bool digit) {
-  digits.push_back(digit);  // por ejemplo: example 011.push_back(1) = 1011
+const uint64_t *BigInt<2>::Magnitude(std::vector<uint64_t> &buffer, size_t &size) const {
+  const uint64_t *limbs = words_.data();
+  if (Sign()) {
+    buffer = words_;
+    Negate(buffer);
+    limbs = buffer.data();
+  }
+  size = words_.size();
+  while (size > 0 && limbs[size - 1] == 0) {
+    size--;
+  }
+  return limbs;
 }
 
 /**
- * @brief Multiplica 2 objetos BigInt<2>. Se utiliza el algoritmo de Robertson
+ * @brief Construye un BigInt<2> en complemento a 2 con el menor número de bits (al menos 2) a partir de
+ * una magnitud en limbs de 64 bits y un signo. Los limbs se reutilizan como palabras y, si es negativo,
+ * se niegan en el lugar
  *
- * @param other
+ * @param limbs
+ * @param negative
  * @return BigInt<2>
  */
-BigInt<2> BigInt<2>::operator*(const BigInt<2> &other) const {
-  // se deben añadir ceros al número más pequeño
-  BigInt<2> number_M = *this;
-  BigInt<2> number_Q = other;
-
-  if (number_M.digits.size() > number_Q.digits.size()) {
-    number_Q = other.FillSign(number_M.digits.size() - number_Q.digits.size());
-  } else if (number_M.digits.size() < number_Q.digits.size()) {
-    number_M = this->FillSign(number_Q.digits.size() - number_M.digits.size());
-  }
-  number_M.push_back(number_M.digits[number_M.digits.size() - 1]);
-  size_t n = number_M.digits.size();
-  std::vector<bool> aux(n, false);
-  BigInt<2> number_A(aux);
-  for (size_t i = 0; i < number_Q.digits.size() - 1; i++) {
-    if (number_Q.digits[0]) {
-      number_A = suma_overflow(number_A, number_M);
-    }
-    number_Q << number_A;
+BigInt<2> BigInt<2>::FromMagnitude(std::vector<uint64_t> limbs, bool negative) {
+  size_t size = limbs.size();
+  while (size > 0 && limbs[size - 1] == 0) {
+    size--;
+  }
+  if (size == 0) {
+    limbs.assign(1, 0);
+    return BigInt<2>(std::move(limbs), 2);
+  }
+  size_t length = 64 * size - __builtin_clzll(limbs[size - 1]);
+  // -2^(length-1) cabe en length bits; cualquier otro valor necesita un bit más para el signo
+  bool power = (limbs[size - 1] & (limbs[size - 1] - 1)) == 0;
+  for (size_t i = 0; power && i + 1 < size; i++) {
+    power = limbs[i] == 0;
   }
-  if (number_Q.digits[0]) {
-    number_A = number_A - number_M;
+  size_t width = std::max<size_t>((negative && power) ? length : length + 1, 2);
+  limbs.resize((width + 63) / 64, 0);
+  if (negative) {
+    Negate(limbs);
   }
-  number_Q << number_A;
-  std::vector<bool> result;
-  result.insert(result.begin(), number_Q.digits.begin(), number_Q.digits.end());
-  result.insert(result.end(), number_A.digits.begin(), number_A.digits.end() - 1);
+  return BigInt<2>(std::move(limbs), width);
+}
 
-  // se limpia el bit de signo
-  while (result.size() > 2 && (result.back() == *(result.end() - 2)) ) {
-    result.erase(result.end() - 1);
+/**
+ * @brief Valor absoluto del número como cantidad de posiciones (de un desplazamiento o del factorial)
+ *
+ * @param limit mayor cantidad admitida
+ * @return size_t
+ * @throw BigIntOutOfRange si el valor absoluto supera limit
+ */
+size_t BigInt<2>::ShiftCount(size_t limit) const {
+  std::vector<uint64_t> buffer;
+  size_t size;
+  const uint64_t *magnitude = Magnitude(buffer, size);
+  if (size > 1 || (size == 1 && magnitude[0] > limit)) {
+    throw BigIntOutOfRange("Count out of range");
+  }
+  return size == 0 ? 0 : magnitude[0];
+}
+
+/**
+ * @brief Bit de signo del número. Como la última palabra tiene el signo extendido, es su bit superior
+ *
+ * @return true si es negativo
+ * @return false si es positivo o no tiene bits
+ */
+bool BigInt<2>::Sign() const {
+  return !words_.empty() && (words_.back() >> 63) != 0;
+}
+
+/**
+ * @brief Devuelve la palabra i-ésima; por encima de las almacenadas devuelve la palabra de signo
+ *
+ * @param i
+ * @return uint64_t
+ */
+uint64_t BigInt<2>::Word(size_t i) const {
+  if (i < words_.size()) {
+    return words_[i];
+  }
+  return Sign() ? ~static_cast<uint64_t>(0) : 0;
+}
+
+/**
+ * @brief Extiende el signo (el bit size_ - 1) sobre los bits libres de la última palabra
+ *
+ */
+void BigInt<2>::Extend() {
+  unsigned used = size_ % 64;
+  if (used != 0) {
+    words_.back() = static_cast<uint64_t>(static_cast<int64_t>(words_.back() << (64 - used)) >> (64 - used));
   }
+}
 
-  return BigInt<2>(result);
+/**
+ * @brief Añade palabras de signo hasta que quepan width + 1 bits, para operar sin desbordar las palabras
+ *
+ * @param width
+ */
+void BigInt<2>::Widen(size_t width) {
+  size_t size = (width + 64) / 64;
+  if (words_.size() < size) {
+    words_.resize(size, Sign() ? ~static_cast<uint64_t>(0) : 0);
+  }
 }
 
 /**
- * @brief Se comprueba que un número sea igual a 0
+ * @brief Ajusta el tamaño tras una operación cuyo resultado exacto cabe en width + 1 bits: se queda con
+ * width bits salvo que el bit width difiera del bit width - 1 (desbordamiento), en cuyo caso añade uno
+ *
+ * @param width
+ */
+void BigInt<2>::Fit(size_t width) {
+  width = std::max<size_t>(width, 1);
+  size_ = (*this)[width] != (*this)[width - 1] ? width + 1 : width;
+  words_.resize((size_ + 63) / 64);
+  Extend();
+}
+
+/**
+ * @brief Niega en complemento a 2 un vector de palabras (se invierten y se suma 1 al vuelo)
+ *
+ * @param words
+ */
+void BigInt<2>::Negate(std::vector<uint64_t> &words) {
+  uint64_t carry = 1;
+  for (size_t i = 0; i < words.size(); i++) {
+    words[i] = ~words[i] + carry;
+    carry = (carry != 0 && words[i] == 0) ? 1 : 0;
+  }
+}
+
+/**
+ * @brief Se comprueba que un número sea igual a 0. Con el signo extendido, basta con que todas las
+ * palabras sean 0
  *
  * @return true
  * @return false
  */
 bool BigInt<2>::IsZero() const {
-  for (size_t i = 0; i < digits.size(); i++) {
-    if (digits[i]) {
+  for (size_t i = 0; i < words_.size(); i++) {
+    if (words_[i] != 0) {
       return false;
     }
   }
@@ -1560,63 +2046,22 @@ bool BigInt<2>::IsZero() const {
  * @return BigInt<2>
  */
 BigInt<2> operator/(const BigInt<2> &first, const BigInt<2> &other) {
-  if(other.IsZero()) {  // se comprueba que other no sea 0
-    std::string message = "Division by zero";
-    throw BigIntDivisionByZero( message );
-  }
-
-  // deben tener el mismo tamaño
-  BigInt<2> number_f = first;
-  BigInt<2> number_s = other;
-  if (number_f.digits.size() > number_s.digits.size()) {
-    number_s = other.FillSign(number_f.digits.size() - number_s.digits.size());
-  } else if (number_f.digits.size() < number_s.digits.size()) {
-    number_f = first.FillSign(number_s.digits.size() - number_f.digits.size());
-  }
-  
-  BigInt<2> number_M = number_s.Abs();
-  std::vector<bool> aux_Q = number_f.Abs().digits;
-  aux_Q.erase(aux_Q.end() - 1);
-  BigInt<2> number_Q(aux_Q);
-  std::vector<bool> aux_A(number_M.digits.size(), false);
-  BigInt<2> number_A(aux_A);
-
-  for (size_t i = 0; i < number_Q.digits.size(); i++) {
-    number_Q >> number_A;
-    number_A = number_A.suma_overflow(number_A, -number_M);
-    if (number_A.digits[number_A.size() - 1]) {
-      number_Q.digits[0] = false;
-      number_A = number_A + number_M;
-    } else {
-      number_Q.digits[0] = true;
-    }
-  }
-  
-  // solo el cociente
-  std::vector<bool> result;
-  result.insert(result.begin(), number_Q.digits.begin(), number_Q.digits.end());
-  
-  // se limpia el bit de signo
-  while ( result.size() > 2 && (result.back() == *(result.end() - 2)) && result.back() == 0) {
-    result.erase(result.end() - 1);
-  }
-  
-  // cambia el signo si el primero y el segundo son distintos
-  BigInt<2> number_Q_r(result);
-  if (first.digits[first.digits.size() - 1] !=
-      other.digits[other.digits.size() - 1]) {
-    number_Q_r = number_Q_r.ComplementoA2();
-  }
-  return number_Q_r;
+  return first.DivMod(other).first;
 }
 
 /**
- * @brief Incrementa el objeto BigInt<2> en 1 unidad (pre-incremento)
+ * @brief Incrementa el objeto BigInt<2> en 1 unidad (pre-incremento). El acarreo se propaga por palabras
+ * en el lugar y se detiene en la primera que no desborda; solo se añade un bit si hay desbordamiento,
+ * igual que en operator+
  *
  * @return BigInt<2>&
  */
 BigInt<2> &BigInt<2>::operator++() {
-  *this = *this + BigInt<2>("01");
+  static const uint64_t one = 1;
+  size_t width = std::max<size_t>(size_, 2);
+  Widen(width);
+  Limbs<2>::AddTo(words_.data(), words_.size(), &one, 1);
+  Fit(width);
   return *this;
 }
 
@@ -1627,17 +2072,22 @@ BigInt<2> &BigInt<2>::operator++() {
  */
 BigInt<2> BigInt<2>::operator++(int) {
   BigInt<2> aux = *this;
-  (*this) = (*this) + BigInt<2>("01");
+  ++(*this);
   return aux;
 }
 
 /**
- * @brief Decrementa el objeto BigInt<2> en 1 unidad (pre-decremento)
+ * @brief Decrementa el objeto BigInt<2> en 1 unidad (pre-decremento). El préstamo se propaga por palabras
+ * en el lugar y se detiene en la primera que no es 0
  *
  * @return BigInt<2>&
  */
 BigInt<2> &BigInt<2>::operator--() {
-  *this = *this - BigInt<2>("01");
+  static const uint64_t one = 1;
+  size_t width = std::max<size_t>(size_, 2);
+  Widen(width);
+  Limbs<2>::SubtractFrom(words_.data(), words_.size(), &one, 1);
+  Fit(width);
   return *this;
 }
 
@@ -1648,21 +2098,21 @@ BigInt<2> &BigInt<2>::operator--() {
  */
 BigInt<2> BigInt<2>::operator--(int) {
   BigInt<2> aux = *this;
-  (*this) = (*this) - BigInt<2>("01");
+  --(*this);
   return aux;
 }
 
 /**
- * @brief Rellena el número con ceros a la izquierda
+ * @brief Extiende el signo n bits por la izquierda. Los bits libres de la última palabra ya tienen el
+ * signo, así que solo se añaden palabras de signo completas
  *
  * @param n
  * @return BigInt<2>
  */
 BigInt<2> BigInt<2>::FillSign(size_t n) const {
-  std::string aux = this->to_string();
-  char sign = aux[0];
-  aux.insert(0, n, sign);
-  BigInt<2> result(aux);
+  BigInt<2> result(*this);
+  result.size_ += n;
+  result.words_.resize((result.size_ + 63) / 64, Sign() ? ~static_cast<uint64_t>(0) : 0);
   return result;
 }
 
@@ -1672,114 +2122,107 @@ BigInt<2> BigInt<2>::FillSign(size_t n) const {
  * @return BigInt<2>
  */
 BigInt<2> BigInt<2>::Abs() const {
-  if (digits[digits.size() - 1]) {
+  if (Sign()) {
     return this->ComplementoA2();
   }
   return *this;
 }
 
 /**
- * @brief Pasa un número en binario a complemento a 2
+ * @brief Pasa un número en binario a complemento a 2, negando las palabras. Se mantiene el tamaño salvo
+ * para el menor negativo (por ejemplo, 100 pasa a ser 0100 y no sale de rango)
  *
  * @return BigInt<2>
  */
 BigInt<2> BigInt<2>::ComplementoA2() const {
-  std::vector<bool> aux;
-  bool flag = false;
-  // se debe añadir un cero por la izquierda para que el algoritmo funcione correctamente para, por ejemplo,
-  // hacer que 100 sea 0100 y no salga de rango
-  bool number_exceptional = true;
-  if (digits[digits.size() - 1]) {
-    for (size_t i = 0; i < digits.size() - 1; i++) {
-      if (digits[i] == 1) {
-        number_exceptional = false;
-        break;
-      }
-    }
-  } else {
-    number_exceptional = false;
-  }
-  BigInt<2> number = *this;
-  if (number_exceptional) {
-    number.push_back(1);
-  }
-  for (size_t i = 0; i < number.size(); i++) {
-    if (number[i] == 1 && !flag) {
-      flag = true;
-      aux.push_back(number[i]);
-    } else if (flag) {
-      aux.push_back(!number[i]);
-    } else {
-      aux.push_back(number[i]);
-    }
-  }
-  BigInt<2> result(aux);
+  std::vector<uint64_t> words;
+  words.reserve((size_ + 64) / 64);
+  words.assign(words_.begin(), words_.end());
+  BigInt<2> result(std::move(words), size_);
+  result.Widen(size_);
+  Negate(result.words_);
+  result.Fit(size_);
   return result;
 }
 
 /**
- * @brief Módulo entre 2 números BigInt<2>
+ * @brief Módulo entre 2 números BigInt<2>. El resto tiene el signo del dividendo y se calcula sobre las
+ * magnitudes con Limbs<2>::Remainder, que reutiliza el reductor de Barrett del divisor si se ha usado hace poco
  *
  * @param other
  * @return BigInt<2>
  */
 BigInt<2> BigInt<2>::operator%(const BigInt<2> &other) const {
-  BigInt<2> number_f = *this;
-  BigInt<2> number_s = other;
-  if (number_f.digits.size() > number_s.digits.size()) {
-    number_s = other.FillSign(number_f.digits.size() - number_s.digits.size());
-  } else if (number_f.digits.size() < number_s.digits.size()) {
-    number_f = this->FillSign(number_s.digits.size() - number_f.digits.size());
-  }
-  //
-  BigInt<2> number_M = number_s.Abs();
-  std::vector<bool> aux_Q = number_f.Abs().digits;
-  aux_Q.erase(aux_Q.end() - 1);
-  BigInt<2> number_Q(aux_Q);
-  std::vector<bool> aux_A(number_M.digits.size(), false);
-  BigInt<2> number_A(aux_A);
-
-  for (size_t i = 0; i < number_Q.digits.size(); i++) {
-    number_Q >> number_A;
-    number_A = number_A - number_M;
-    if (number_A.digits[number_A.size() - 1]) {
-      number_Q.digits[0] = false;
-      number_A = number_A + number_M;
-    } else {
-      number_Q.digits[0] = true;
-    }
+  if (other.IsZero()) {  // se comprueba que other no sea 0
+    std::string message = "Division by zero";
+    throw BigIntDivisionByZero(message);
   }
+  return FromMagnitude(Limbs<2>::Remainder(MagnitudeLimbs(), other.MagnitudeLimbs()), Sign());
+}
 
-  std::vector<bool> result;
-  result.insert(result.begin(), number_A.digits.begin(),
-                number_A.digits.end() - 1);
-  BigInt<2> number_Q_r(result);
-  return number_Q_r;
+/**
+ * @brief Calcula el cociente y el resto de 2 números BigInt<2> con una sola división de Limbs<2> sobre
+ * las magnitudes. La división es truncada: el resto tiene el signo del dividendo
+ *
+ * @param other
+ * @return std::pair<BigInt<2>, BigInt<2>>
+ */
+std::pair<BigInt<2>, BigInt<2>> BigInt<2>::DivMod(const BigInt<2> &other) const {
+  if (other.IsZero()) {  // se comprueba que other no sea 0
+    std::string message = "Division by zero";
+    throw BigIntDivisionByZero(message);
+  }
+  bool negative_x = Sign();
+  bool negative_y = other.Sign();
+  std::vector<uint64_t> quotient, remainder;
+  Limbs<2>::Divide(this->MagnitudeLimbs(), other.MagnitudeLimbs(), quotient, remainder);
+  bool negative_quotient = negative_x != negative_y && !quotient.empty();
+  bool negative_remainder = negative_x && !remainder.empty();
+  return std::make_pair(FromMagnitude(std::move(quotient), negative_quotient),
+                        FromMagnitude(std::move(remainder), negative_remainder));
 }
 
 /**
- * @brief Función para calcular la potencia de un BigInt<2>
+ * @brief Función para calcular la potencia de un BigInt<2>. Si |first| es una potencia de 2 (incluidos 0 y
+ * ±1) el resultado es un único bit desplazado; si no, la magnitud se eleva con la ventana deslizante de
+ * Limbs<2>, que lee los bits del exponente de sus palabras. Un exponente negativo da 0
  *
  * @param first 
  * @param other 
  * @return BigInt<2> 
+ * @throw BigIntOutOfRange si una potencia de 2 supera kMaxShift bits
  */
 BigInt<2> pow(const BigInt<2> &first, const BigInt<2> &other) {
-  static  BigInt<2> zero ("00");
-  static  BigInt<2> one ("01");
-  static  BigInt<2> two ("010");
-  if (other < zero) {
-    return zero;
-  }
-  if (other == zero) {
-    return one;
-  } else if (other % two == zero) {
-    BigInt<2> half = pow(first, other / two);
-    return half * half;
-  } else {
-    BigInt<2> half = pow(first, (other - one) / two);
-    return half * half * first;
+  if (other.Sign()) {
+    return BigInt<2>::FromMagnitude(std::vector<uint64_t>(), false);
+  }
+  std::vector<uint64_t> exponent = other.MagnitudeLimbs();
+  if (exponent.empty()) {
+    return BigInt<2>::FromMagnitude(std::vector<uint64_t>(1, 1), false);
+  }
+  std::vector<uint64_t> magnitude = first.MagnitudeLimbs();
+  bool negative = first.Sign() && (exponent[0] & 1) != 0;
+  if (magnitude.empty()) {
+    return BigInt<2>::FromMagnitude(std::move(magnitude), false);
+  }
+  // |first| = 2^bits: el resultado es 2^(bits * other)
+  size_t top = magnitude.size() - 1;
+  bool power = (magnitude[top] & (magnitude[top] - 1)) == 0;
+  for (size_t i = 0; power && i < top; i++) {
+    power = magnitude[i] == 0;
+  }
+  if (power) {
+    size_t bits = 64 * top + __builtin_ctzll(magnitude[top]);
+    size_t shift = 0;
+    if (bits != 0 && (exponent.size() > 1 || __builtin_mul_overflow(bits, exponent[0], &shift) ||
+                      shift > BigInt<2>::kMaxShift)) {
+      throw BigIntOutOfRange("Power out of range");
+    }
+    std::vector<uint64_t> result(shift / 64 + 1, 0);
+    result.back() = static_cast<uint64_t>(1) << (shift % 64);
+    return BigInt<2>::FromMagnitude(std::move(result), negative);
   }
+  return BigInt<2>::FromMagnitude(Limbs<2>::Pow(magnitude, exponent), negative);
 }
 
 /**
@@ -1793,20 +2236,107 @@ BigInt<2> BigInt<2>::operator^(const BigInt<2> &other) const {
 }
 
 /**
- * @brief  Función para calcular el factorial de un BigInt<2>
+ * @brief Potencia modular: (*this)^exponent mod modulus sin construir la potencia, con la exponenciación de
+ * Montgomery de Limbs<2> sobre las magnitudes. Como (*this ^ exponent) % modulus, el resultado tiene el
+ * signo de la potencia y un exponente negativo da 0
+ *
+ * @param exponent
+ * @param modulus
+ * @return BigInt<2>
+ */
+BigInt<2> BigInt<2>::PowMod(const BigInt<2> &exponent, const BigInt<2> &modulus) const {
+  if (modulus.IsZero()) {
+    std::string message = "Division by zero";
+    throw BigIntDivisionByZero(message);
+  }
+  if (exponent.Sign()) {
+    return FromMagnitude(std::vector<uint64_t>(), false);
+  }
+  std::vector<uint64_t> bits = exponent.MagnitudeLimbs();
+  bool negative = Sign() && !bits.empty() && (bits[0] & 1) != 0;
+  return FromMagnitude(Limbs<2>::PowMod(MagnitudeLimbs(), bits, modulus.MagnitudeLimbs()), negative);
+}
+
+/**
+ * @brief Máximo común divisor de los valores absolutos (Lehmer y half-gcd de Limbs<2>). gcd(0, 0) es 0
+ *
+ * @param other
+ * @return BigInt<2>
+ */
+BigInt<2> BigInt<2>::Gcd(const BigInt<2> &other) const {
+  return FromMagnitude(Limbs<2>::Gcd(MagnitudeLimbs(), other.MagnitudeLimbs()), false);
+}
+
+/**
+ * @brief Máximo común divisor g con los cofactores de Bézout: g = s * (*this) + t * other. El signo de cada
+ * cofactor sigue al de su operando y |s| <= |other| / 2g
+ *
+ * @param other
+ * @param s
+ * @param t
+ * @return BigInt<2>
+ */
+BigInt<2> BigInt<2>::ExtendedGcd(const BigInt<2> &other, BigInt<2> &s, BigInt<2> &t) const {
+  std::vector<uint64_t> s_limbs, t_limbs;
+  bool s_negative, t_negative;
+  std::vector<uint64_t> gcd = Limbs<2>::ExtendedGcd(MagnitudeLimbs(), other.MagnitudeLimbs(), s_limbs, s_negative,
+                                                    t_limbs, t_negative);
+  s = FromMagnitude(std::move(s_limbs), s_negative != Sign());
+  t = FromMagnitude(std::move(t_limbs), t_negative != other.Sign());
+  return FromMagnitude(std::move(gcd), false);
+}
+
+/**
+ * @brief Inverso del número módulo modulus, en [0, |modulus|). Solo existe si el mcd es 1
+ *
+ * @param modulus
+ * @return BigInt<2>
+ */
+BigInt<2> BigInt<2>::ModInverse(const BigInt<2> &modulus) const {
+  if (modulus.IsZero()) {
+    std::string message = "Division by zero";
+    throw BigIntDivisionByZero(message);
+  }
+  BigInt<2> s, t;
+  std::vector<uint64_t> gcd = ExtendedGcd(modulus, s, t).MagnitudeLimbs();
+  if (gcd.size() != 1 || gcd[0] != 1) {
+    std::string message = "Not invertible";
+    throw BigIntNotInvertible(message);
+  }
+  if (s.Sign()) {
+    return FromMagnitude(Limbs<2>::Subtract(modulus.MagnitudeLimbs(), s.MagnitudeLimbs()), false);
+  }
+  return s;
+}
+
+/**
+ * @brief Mínimo común múltiplo de los valores absolutos: |x| / gcd * |y|. Es 0 si algún operando lo es
+ *
+ * @param other
+ * @return BigInt<2>
+ */
+BigInt<2> BigInt<2>::Lcm(const BigInt<2> &other) const {
+  std::vector<uint64_t> magnitude_x = MagnitudeLimbs(), magnitude_y = other.MagnitudeLimbs();
+  if (magnitude_x.empty() || magnitude_y.empty()) {
+    return FromMagnitude(std::vector<uint64_t>(), false);
+  }
+  std::vector<uint64_t> quotient, remainder;
+  Limbs<2>::Divide(magnitude_x, Limbs<2>::Gcd(magnitude_x, magnitude_y), quotient, remainder);
+  return FromMagnitude(Limbs<2>::Multiply(quotient, magnitude_y), false);
+}
+
+/**
+ * @brief  Función para calcular el factorial de un BigInt<2> con el prime-swing de Limbs<2>::Factorial.
+ * El factorial de un número negativo es 1
  * 
  * @return BigInt<2> 
+ * @throw BigIntOutOfRange si el número supera kMaxFactorial
  */
 BigInt<2> BigInt<2>::factorial() const {
-  BigInt<2> result("01");
-  BigInt<2> one("01");
-  BigInt<2> zero("00");
-  BigInt<2> i("01");
-  while (i <= *this) {
-    result = result * i;
-    i = i + one;
+  if (Sign()) {
+    return FromMagnitude(std::vector<uint64_t>(1, 1), false);
   }
-  return result;
+  return FromMagnitude(Limbs<2>::Factorial(ShiftCount(kMaxFactorial)), false);
 }
 
 /**
@@ -1819,16 +2349,408 @@ BigInt<2> BigInt<2>::operator!() const{
 }
 
 /**
- * @brief Operador para calcular la suma acumulando el resultado a la izquierda de la igualdad
- * 
+ * @brief Suma en el lugar de 2 números en complemento a 2. Las palabras del operando izquierdo se extienden
+ * con su signo hasta el tamaño del mayor y se suman con acarreo sobre el propio vector; como en operator+,
+ * solo se añade un bit si hay desbordamiento
+ *
  * @param number_y
- * @return BigInt<2> 
+ * @return BigInt<2>&
  */
-BigInt<2> BigInt<2>::operator+=(const BigInt<2> &number_y) const {
-  BigInt<2> aux = *this;
-  BigInt<2> other = number_y;
-  //return *this = *this + number_y;
-  return aux = aux + other;
+BigInt<2> &BigInt<2>::operator+=(const BigInt<2> &number_y) {
+  if (this == &number_y) {
+    BigInt<2> copy = number_y;
+    return *this += copy;
+  }
+  static const uint64_t one = 1;
+  size_t width = std::max(size_, number_y.size_);
+  Widen(width);
+  size_t size_y = number_y.words_.size();
+  Limbs<2>::AddTo(words_.data(), words_.size(), number_y.words_.data(), size_y);
+  if (number_y.Sign() && size_y < words_.size()) {
+    // las palabras de signo de y (todas a 1) valen -2^(64 * size_y) módulo el tamaño: se resta 1 desde ahí
+    Limbs<2>::SubtractFrom(words_.data() + size_y, words_.size() - size_y, &one, 1);
+  }
+  Fit(width);
+  return *this;
+}
+
+/**
+ * @brief Resta en el lugar con préstamo por palabras. El tamaño del resultado es el mismo que el de x + (-y)
+ *
+ * @param number_y
+ * @return BigInt<2>&
+ */
+BigInt<2> &BigInt<2>::operator-=(const BigInt<2> &number_y) {
+  if (this == &number_y) {
+    BigInt<2> copy = number_y;
+    return *this -= copy;
+  }
+  static const uint64_t one = 1;
+  // -y necesita un bit más si y es el menor negativo de su tamaño (10...0)
+  size_t size_y = number_y.words_.size();
+  bool minimum = number_y.Sign();
+  for (size_t i = 0; minimum && i + 1 < size_y; i++) {
+    minimum = number_y.words_[i] == 0;
+  }
+  minimum = minimum && number_y.words_.back() == ~static_cast<uint64_t>(0) << ((number_y.size_ - 1) % 64);
+  size_t width = std::max(size_, number_y.size_ + (minimum ? 1 : 0));
+  Widen(width);
+  Limbs<2>::SubtractFrom(words_.data(), words_.size(), number_y.words_.data(), size_y);
+  if (number_y.Sign() && size_y < words_.size()) {
+    // restar las palabras de signo de y (todas a 1) equivale a sumar 1 desde la palabra size_y
+    Limbs<2>::AddTo(words_.data() + size_y, words_.size() - size_y, &one, 1);
+  }
+  Fit(width);
+  return *this;
+}
+
+/**
+ * @brief Multiplicación con asignación
+ *
+ * @param number_y
+ * @return BigInt<2>&
+ */
+BigInt<2> &BigInt<2>::operator*=(const BigInt<2> &number_y) {
+  *this = *this * number_y;
+  return *this;
+}
+
+/**
+ * @brief División con asignación
+ *
+ * @param number_y
+ * @return BigInt<2>&
+ */
+BigInt<2> &BigInt<2>::operator/=(const BigInt<2> &number_y) {
+  *this = DivMod(number_y).first;
+  return *this;
+}
+
+/**
+ * @brief Módulo con asignación
+ *
+ * @param number_y
+ * @return BigInt<2>&
+ */
+BigInt<2> &BigInt<2>::operator%=(const BigInt<2> &number_y) {
+  *this = *this % number_y;
+  return *this;
+}
+
+/**
+ * @brief Desplaza el número n bits a la izquierda en el lugar (multiplica por 2^n), insertando ceros en
+ * los bits menos significativos
+ *
+ * @param n
+ * @return BigInt<2>&
+ */
+BigInt<2> &BigInt<2>::operator<<=(size_t n) {
+  if (n == 0 || IsZero()) {
+    return *this;
+  }
+  size_t shift_words = n / 64;
+  unsigned shift_bits = n % 64;
+  size_t old_size = words_.size();
+  uint64_t fill = Sign() ? ~static_cast<uint64_t>(0) : 0;
+  size_ += n;
+  words_.resize((size_ + 63) / 64, fill);
+  // se recorre desde la palabra más significativa para poder desplazar en el lugar
+  for (size_t i = words_.size(); i > 0; i--) {
+    size_t source = i - 1 - std::min(i - 1, shift_words);
+    uint64_t high = i - 1 < shift_words ? 0 : (source < old_size ? words_[source] : fill);
+    uint64_t low = (i - 1 < shift_words + 1 || shift_bits == 0) ? 0 : words_[source - 1];
+    words_[i - 1] = shift_bits == 0 ? high : (high << shift_bits) | (low >> (64 - shift_bits));
+  }
+  Extend();
+  return *this;
+}
+
+/**
+ * @brief Desplazamiento aritmético de n bits a la derecha en el lugar (divide por 2^n redondeando hacia
+ * abajo). Se mueven palabras completas y el resto de bits se combina con la palabra siguiente; el tamaño
+ * se reduce en n bits, con un mínimo de 2
+ *
+ * @param n
+ * @return BigInt<2>&
+ */
+BigInt<2> &BigInt<2>::operator>>=(size_t n) {
+  if (n == 0) {
+    return *this;
+  }
+  size_t shift_words = n / 64;
+  unsigned shift_bits = n % 64;
+  size_t old_size = words_.size();
+  uint64_t fill = Sign() ? ~static_cast<uint64_t>(0) : 0;
+  auto word = [&](size_t i) { return i < old_size ? words_[i] : fill; };
+  size_ = size_ > 2 && n < size_ - 2 ? size_ - n : 2;
+  size_t size = (size_ + 63) / 64;
+  // se recorre desde la palabra menos significativa: cada una solo lee palabras que aún no se han escrito
+  for (size_t i = 0; i < size; i++) {
+    uint64_t low = word(i + shift_words);
+    uint64_t high = word(i + shift_words + 1);
+    uint64_t value = shift_bits == 0 ? low : (low >> shift_bits) | (high << (64 - shift_bits));
+    if (i < old_size) {
+      words_[i] = value;
+    } else {
+      words_.push_back(value);
+    }
+  }
+  words_.resize(size);
+  Extend();
+  return *this;
+}
+
+/**
+ * @brief Devuelve el número desplazado n bits a la izquierda (multiplicado por 2^n)
+ *
+ * @param n
+ * @return BigInt<2>
+ */
+BigInt<2> BigInt<2>::operator<<(size_t n) const {
+  BigInt<2> result(*this);
+  result <<= n;
+  return result;
+}
+
+/**
+ * @brief Devuelve el número desplazado aritméticamente n bits a la derecha (dividido por 2^n redondeando
+ * hacia abajo)
+ *
+ * @param n
+ * @return BigInt<2>
+ */
+BigInt<2> BigInt<2>::operator>>(size_t n) const {
+  BigInt<2> result(*this);
+  result >>= n;
+  return result;
+}
+
+/**
+ * @brief Núcleo de las operaciones lógicas: x[i] = x[i] op y[i] para size palabras. Si y es nulo, cada
+ * palabra se opera con fill (la palabra de signo del operando más corto). Con AVX2 se procesan 4
+ * palabras por instrucción y el resto con la versión escalar
+ *
+ * @param number_x
+ * @param number_y
+ * @param fill
+ * @param size
+ * @param operation
+ */
+void BigInt<2>::BitwiseWords(uint64_t *number_x, const uint64_t *number_y, uint64_t fill, size_t size,
+                             BitwiseOperation operation) {
+  size_t i = 0;
+#ifdef __AVX2__
+  __m256i fill_vector = _mm256_set1_epi64x(static_cast<long long>(fill));
+  for (; i + 4 <= size; i += 4) {
+    __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(number_x + i));
+    __m256i y = number_y == nullptr ? fill_vector
+                                    : _mm256_loadu_si256(reinterpret_cast<const __m256i *>(number_y + i));
+    __m256i result = operation == kAnd ? _mm256_and_si256(x, y)
+                     : operation == kOr ? _mm256_or_si256(x, y)
+                                        : _mm256_xor_si256(x, y);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(number_x + i), result);
+  }
+#endif
+  for (; i < size; i++) {
+    uint64_t y = number_y == nullptr ? fill : number_y[i];
+    number_x[i] = operation == kAnd ? number_x[i] & y : operation == kOr ? number_x[i] | y : number_x[i] ^ y;
+  }
+}
+
+/**
+ * @brief Aplica en el lugar una operación lógica bit a bit en complemento a 2: el más corto se extiende
+ * con su signo y el resultado tiene el tamaño del mayor
+ *
+ * @param other
+ * @param operation
+ * @return BigInt<2>&
+ */
+BigInt<2> &BigInt<2>::Bitwise(const BigInt<2> &other, BitwiseOperation operation) {
+  uint64_t fill_y = other.Sign() ? ~static_cast<uint64_t>(0) : 0;
+  size_t width = std::max(size_, other.size_);
+  words_.resize((width + 63) / 64, Sign() ? ~static_cast<uint64_t>(0) : 0);
+  size_t size_y = other.words_.size();
+  BitwiseWords(words_.data(), other.words_.data(), 0, size_y, operation);
+  BitwiseWords(words_.data() + size_y, nullptr, fill_y, words_.size() - size_y, operation);
+  size_ = width;
+  Extend();
+  return *this;
+}
+
+/**
+ * @brief Copia las palabras del número reservando espacio para width bits, para operar sobre la copia
+ * sin volver a reservar
+ *
+ * @param width
+ * @return BigInt<2>
+ */
+BigInt<2> BigInt<2>::Reserved(size_t width) const {
+  std::vector<uint64_t> words;
+  words.reserve(std::max(words_.size(), (width + 63) / 64));
+  words.assign(words_.begin(), words_.end());
+  return BigInt<2>(std::move(words), size_);
+}
+
+/**
+ * @brief AND bit a bit en el lugar
+ *
+ * @param other
+ * @return BigInt<2>&
+ */
+BigInt<2> &BigInt<2>::operator&=(const BigInt<2> &other) {
+  return Bitwise(other, kAnd);
+}
+
+/**
+ * @brief OR bit a bit en el lugar
+ *
+ * @param other
+ * @return BigInt<2>&
+ */
+BigInt<2> &BigInt<2>::operator|=(const BigInt<2> &other) {
+  return Bitwise(other, kOr);
+}
+
+/**
+ * @brief XOR bit a bit en el lugar (operator^ es la potencia)
+ *
+ * @param other
+ * @return BigInt<2>&
+ */
+BigInt<2> &BigInt<2>::XorEqual(const BigInt<2> &other) {
+  return Bitwise(other, kXor);
+}
+
+/**
+ * @brief AND bit a bit de 2 números en complemento a 2
+ *
+ * @param other
+ * @return BigInt<2>
+ */
+BigInt<2> BigInt<2>::operator&(const BigInt<2> &other) const {
+  BigInt<2> result = Reserved(other.size_);
+  return result &= other;
+}
+
+/**
+ * @brief OR bit a bit de 2 números en complemento a 2
+ *
+ * @param other
+ * @return BigInt<2>
+ */
+BigInt<2> BigInt<2>::operator|(const BigInt<2> &other) const {
+  BigInt<2> result = Reserved(other.size_);
+  return result |= other;
+}
+
+/**
+ * @brief XOR bit a bit de 2 números en complemento a 2
+ *
+ * @param other
+ * @return BigInt<2>
+ */
+BigInt<2> BigInt<2>::Xor(const BigInt<2> &other) const {
+  BigInt<2> result = Reserved(other.size_);
+  return result.XorEqual(other);
+}
+
+/**
+ * @brief NOT bit a bit: invierte todos los bits (~x = -x - 1) manteniendo el tamaño
+ *
+ * @return BigInt<2>
+ */
+BigInt<2> BigInt<2>::operator~() const {
+  BigInt<2> result(*this);
+  BitwiseWords(result.words_.data(), nullptr, ~static_cast<uint64_t>(0), result.words_.size(), kXor);
+  return result;
+}
+
+/**
+ * @brief Número de bits distintos del bit de signo (los bits a 1 si es positivo y a 0 si es negativo),
+ * que no depende del tamaño de la representación
+ *
+ * @return size_t
+ */
+size_t BigInt<2>::PopCount() const {
+  uint64_t fill = Sign() ? ~static_cast<uint64_t>(0) : 0;
+  size_t count = 0;
+  for (size_t i = 0; i < words_.size(); i++) {
+    count += __builtin_popcountll(words_[i] ^ fill);
+  }
+  return count;
+}
+
+/**
+ * @brief Comprueba el bit n (por encima del tamaño se lee el signo)
+ *
+ * @param n
+ * @return true
+ * @return false
+ */
+bool BigInt<2>::TestBit(size_t n) const {
+  return (*this)[n];
+}
+
+/**
+ * @brief Pone a 1 el bit n en el lugar. Si n no queda por debajo del bit de signo, se extiende el signo
+ * hasta n + 2 bits para que el signo no cambie por accidente
+ *
+ * @param n
+ * @return BigInt<2>&
+ */
+BigInt<2> &BigInt<2>::SetBit(size_t n) {
+  if (n + 1 >= size_) {
+    *this = FillSign(n + 2 - size_);
+  }
+  words_[n / 64] |= static_cast<uint64_t>(1) << (n % 64);
+  return *this;
+}
+
+/**
+ * @brief Pone a 0 el bit n en el lugar, extendiendo el signo como en SetBit
+ *
+ * @param n
+ * @return BigInt<2>&
+ */
+BigInt<2> &BigInt<2>::ClearBit(size_t n) {
+  if (n + 1 >= size_) {
+    *this = FillSign(n + 2 - size_);
+  }
+  words_[n / 64] &= ~(static_cast<uint64_t>(1) << (n % 64));
+  return *this;
+}
+
+/**
+ * @brief Número de bits a 0 por la izquierda dentro del tamaño del número (0 si es negativo y el tamaño
+ * completo si es 0)
+ *
+ * @return size_t
+ */
+size_t BigInt<2>::CountLeadingZeros() const {
+  if (Sign()) {
+    return 0;
+  }
+  size_t unused = 64 * words_.size() - size_;  // bits de la última palabra por encima del tamaño
+  for (size_t i = words_.size(); i > 0; i--) {
+    if (words_[i - 1] != 0) {
+      return 64 * (words_.size() - i) + __builtin_clzll(words_[i - 1]) - unused;
+    }
+  }
+  return size_;
+}
+
+/**
+ * @brief Número de bits a 0 por la derecha (el tamaño completo si el número es 0)
+ *
+ * @return size_t
+ */
+size_t BigInt<2>::CountTrailingZeros() const {
+  for (size_t i = 0; i < words_.size(); i++) {
+    if (words_[i] != 0) {
+      return 64 * i + __builtin_ctzll(words_[i]);
+    }
+  }
+  return size_;
 }
 
 /**
@@ -1850,42 +2772,15 @@ BigInt<2> BigInt<2>::operator-() const{
  }
 
 /**
- * @brief Convierte un número BigInt<2> en un BigInt<Base>
+ * @brief Convierte un número BigInt<2> en un BigInt<Base> con el cambio de base divide y vencerás de Limbs
  * 
  * @tparam base 
  * @return BigInt<base> 
  */
 template <size_t base>
-BigInt<base> BigInt<2>::ConvertBaseT(){
-  BigInt<base> result("0");
-  BigInt<2> number = this->Abs();
-  BigInt<2> zero2("00");
-  if (number == zero2) {
-    return result;
-  }
-  BigInt<base> expo("0");
-  BigInt<base> one("1");
-  BigInt<base> two(2);
-  for (size_t i = 0; i < number.size(); i++) {
-    if (number[i]) {
-      result = result + two.operator^(expo);  // forzar pow de BigInt<Base> para evitar llamadas a sí mismo
-    }
-    expo++;
-  }
-  
-  // divide el resultado entre la base para guardar el número en un vector
-  BigInt<base> aux = result;
-  BigInt<base> zero("0");
-  BigInt<base> base_number(base);
-  std::vector<char> digits_aux;
-  while (aux != zero) {
-    BigInt<base> mod = aux % base_number;
-    digits_aux.push_back(mod[0]);
-    aux = aux / base_number;
-  } 
-  int sign = this->digits[this->digits.size() - 1] ? -1 : 1;
-  BigInt<base> result_final(digits_aux, sign);
-  return result_final;
+BigInt<base> BigInt<2>::ConvertBaseT() const {
+  int sign = Sign() ? -1 : 1;
+  return BigInt<base>(Limbs<base>::FromBinary(MagnitudeLimbs()), sign, BigInt<base>::kUnchecked);
 }
 
 /**
@@ -1895,8 +2790,7 @@ BigInt<base> BigInt<2>::ConvertBaseT(){
  * @return BigInt<8> 
  */
 BigInt<2>::operator BigInt<8>()const{
-  BigInt<2> aux = *this;
-  return aux.ConvertBaseT<8>();
+  return ConvertBaseT<8>();
 }
 
 /**
@@ -1906,8 +2800,7 @@ BigInt<2>::operator BigInt<8>()const{
  * @return BigInt<10> 
  */
 BigInt<2>::operator BigInt<10>()const{
-  BigInt<2> aux = *this;
-  return aux.ConvertBaseT<10>();
+  return ConvertBaseT<10>();
 }
 
 /**
@@ -1917,8 +2810,7 @@ BigInt<2>::operator BigInt<10>()const{
  * @return BigInt<16> 
  */
 BigInt<2>::operator BigInt<16>()const{
-  BigInt<2> aux = *this;
-  return aux.ConvertBaseT<16>();
+  return ConvertBaseT<16>();
 }
 
 /**
@@ -1929,10 +2821,7 @@ BigInt<2>::operator BigInt<16>()const{
  * @return std::ostream&
  */
 std::ostream &operator<<(std::ostream &os, const BigInt<2> &number_x) {
-
-  for (int i = number_x.digits.size() - 1; i >= 0; i--) {
-    os << number_x.digits[i];
-  }
+  os << number_x.to_string();
   return os;
 }
 
@@ -2030,6 +2919,23 @@ Number* BigInt<2>::add(const Number* otherNum) const {
     return result;
  }
 
+/**
+ * @brief Realiza la división de los números BigInt<2> y devuelve a la vez el cociente y el resto
+ *
+ * @param otherNum
+ * @return std::pair<Number*, Number*>
+ */
+std::pair<Number*, Number*> BigInt<2>::divmod(const Number* otherNum) const {
+  const BigInt* other = dynamic_cast<const BigInt*>(otherNum);
+  std::pair<BigInt<2>, BigInt<2>> result;
+  if (other == nullptr) {
+    result = DivMod(BigInt<2>(*otherNum));
+  } else {
+    result = DivMod(*other);
+  }
+  return std::make_pair(new BigInt<2>(std::move(result.first)), new BigInt<2>(std::move(result.second)));
+}
+
 /**
  * @brief Realiza la potencia de los números BigInt<Base>
  * 
@@ -2046,6 +2952,119 @@ Number* BigInt<2>::add(const Number* otherNum) const {
     return result;
  }
 
+/**
+ * @brief Realiza la potencia modular de los números BigInt<2>
+ *
+ * @param exponentNum
+ * @param modulusNum
+ * @return Number*
+ */
+Number* BigInt<2>::powmod(const Number* exponentNum, const Number* modulusNum) const {
+  return new BigInt<2>(PowMod(static_cast<BigInt<2>>(*exponentNum), static_cast<BigInt<2>>(*modulusNum)));
+}
+
+/**
+ * @brief Calcula el factorial del número BigInt<2> (método virtual de la clase Number)
+ *
+ * @return Number*
+ */
+Number* BigInt<2>::fact() const {
+  return new BigInt<2>(factorial());
+}
+
+/**
+ * @brief Calcula el máximo común divisor de los números BigInt<2> (método virtual de la clase Number)
+ *
+ * @param otherNum
+ * @return Number*
+ */
+Number* BigInt<2>::gcd(const Number* otherNum) const {
+  return new BigInt<2>(Gcd(static_cast<BigInt<2>>(*otherNum)));
+}
+
+/**
+ * @brief Calcula el mínimo común múltiplo de los números BigInt<2> (método virtual de la clase Number)
+ *
+ * @param otherNum
+ * @return Number*
+ */
+Number* BigInt<2>::lcm(const Number* otherNum) const {
+  return new BigInt<2>(Lcm(static_cast<BigInt<2>>(*otherNum)));
+}
+
+/**
+ * @brief Calcula el inverso modular del número BigInt<2> (método virtual de la clase Number)
+ *
+ * @param modulusNum
+ * @return Number*
+ */
+Number* BigInt<2>::modinv(const Number* modulusNum) const {
+  return new BigInt<2>(ModInverse(static_cast<BigInt<2>>(*modulusNum)));
+}
+
+/**
+ * @brief Calcula los cofactores de Bézout (s, t) de los números BigInt<2> (método virtual de la clase Number)
+ *
+ * @param otherNum
+ * @return std::pair<Number*, Number*>
+ */
+std::pair<Number*, Number*> BigInt<2>::xgcd(const Number* otherNum) const {
+  BigInt<2> s, t;
+  ExtendedGcd(static_cast<BigInt<2>>(*otherNum), s, t);
+  return std::make_pair(new BigInt<2>(std::move(s)), new BigInt<2>(std::move(t)));
+}
+
+/**
+ * @brief AND bit a bit de los números BigInt<2> (método virtual de la clase Number)
+ *
+ * @param otherNum
+ * @return Number*
+ */
+Number* BigInt<2>::bitAnd(const Number* otherNum) const {
+  const BigInt* other = dynamic_cast<const BigInt*>(otherNum);
+  if (other == nullptr) {
+    return new BigInt<2>(*this & BigInt<2>(*otherNum));
+  }
+  return new BigInt<2>(*this & *other);
+}
+
+/**
+ * @brief OR bit a bit de los números BigInt<2> (método virtual de la clase Number)
+ *
+ * @param otherNum
+ * @return Number*
+ */
+Number* BigInt<2>::bitOr(const Number* otherNum) const {
+  const BigInt* other = dynamic_cast<const BigInt*>(otherNum);
+  if (other == nullptr) {
+    return new BigInt<2>(*this | BigInt<2>(*otherNum));
+  }
+  return new BigInt<2>(*this | *other);
+}
+
+/**
+ * @brief XOR bit a bit de los números BigInt<2> (método virtual de la clase Number)
+ *
+ * @param otherNum
+ * @return Number*
+ */
+Number* BigInt<2>::bitXor(const Number* otherNum) const {
+  const BigInt* other = dynamic_cast<const BigInt*>(otherNum);
+  if (other == nullptr) {
+    return new BigInt<2>(Xor(BigInt<2>(*otherNum)));
+  }
+  return new BigInt<2>(Xor(*other));
+}
+
+/**
+ * @brief NOT bit a bit del número BigInt<2> (método virtual de la clase Number)
+ *
+ * @return Number*
+ */
+Number* BigInt<2>::bitNot() const {
+  return new BigInt<2>(~*this);
+}
+
 /**
  * @brief Realiza la suma de los números BigInt<2> acumulando el resultado
  *
@@ -2053,13 +3072,53 @@ Number* BigInt<2>::add(const Number* otherNum) const {
  * @return Number*
  */
 Number* BigInt<2>::addEqual(const Number* otherNum) const {
+  // el resultado es un objeto nuevo (las variables de la calculadora no se modifican), pero la suma se
+  // hace en el lugar sobre él, sin copias intermedias de los operandos
   const BigInt* other = dynamic_cast<const BigInt*>(otherNum);
+  BigInt<2>* result = new BigInt<2>(*this);
   if (other == nullptr) {
-    other = new BigInt<2>(*otherNum);
-    return new BigInt<2>(this->operator+=(*other));
+    *result += BigInt<2>(*otherNum);
+  } else {
+    *result += *other;
   }
+  return result;
+}
 
-  BigInt<2> *result = new BigInt<2>(this->operator+=(*other));
+/**
+ * @brief Desplaza el número tantos bits a la izquierda como indique otherNum (multiplica por
+ * 2^otherNum)
+ *
+ * @param otherNum
+ * @return Number*
+ * @throw BigIntOutOfRange si otherNum es negativo o supera kMaxShift
+ */
+Number* BigInt<2>::shiftLeft(const Number* otherNum) const {
+  const BigInt* other = dynamic_cast<const BigInt*>(otherNum);
+  BigInt<2> count = other == nullptr ? BigInt<2>(*otherNum) : *other;
+  if (count.Sign()) {
+    throw BigIntOutOfRange("Negative shift count");
+  }
+  BigInt<2>* result = new BigInt<2>(*this);
+  *result <<= count.ShiftCount(kMaxShift);
+  return result;
+}
+
+/**
+ * @brief Desplaza aritméticamente el número tantos bits a la derecha como indique otherNum (divide por
+ * 2^otherNum redondeando hacia abajo). Un desplazamiento mayor que el ancho da 0 o -1
+ *
+ * @param otherNum
+ * @return Number*
+ * @throw BigIntOutOfRange si otherNum es negativo o no cabe en size_t
+ */
+Number* BigInt<2>::shiftRight(const Number* otherNum) const {
+  const BigInt* other = dynamic_cast<const BigInt*>(otherNum);
+  BigInt<2> count = other == nullptr ? BigInt<2>(*otherNum) : *other;
+  if (count.Sign()) {
+    throw BigIntOutOfRange("Negative shift count");
+  }
+  BigInt<2>* result = new BigInt<2>(*this);
+  *result >>= count.ShiftCount(static_cast<size_t>(-1));
   return result;
 }
 
@@ -40,10 +40,23 @@ void Calculator<T>::InitOperations() {
   operations["/"] = [](T a, T b) { return a->divide(b); };
   operations["%"] = [](T a, T b) { return a->module(b); };
   operations["^"] = [](T a, T b) { return a->pow(b); };
+  operations["<<"] = [](T a, T b) { return a->shiftLeft(b); };   // multiplica por Base^b
+  operations[">>"] = [](T a, T b) { return a->shiftRight(b); };  // divide por Base^b
+  operations["&"] = [](T a, T b) { return a->bitAnd(b); };
+  operations["|"] = [](T a, T b) { return a->bitOr(b); };
+  operations["~^"] = [](T a, T b) { return a->bitXor(b); };  // "^" es la potencia
+  unary_operations["~"] = [](T a) { return a->bitNot(); };
+  unary_operations["!"] = [](T a) { return a->fact(); };
 
   // Extra
   operations["+="] = [](T a, T b) { return a->addEqual(b); };
   unary_operations["+=u"] = [](T a) { return a->addEqual(a); }; // versión unaria
+  pair_operations["/%"] = [](T a, T b) { return a->divmod(b); };  // apila el cociente y encima el resto
+  operations["gcd"] = [](T a, T b) { return a->gcd(b); };
+  operations["lcm"] = [](T a, T b) { return a->lcm(b); };
+  operations["modinv"] = [](T a, T b) { return a->modinv(b); };  // inverso de a módulo b
+  pair_operations["xgcd"] = [](T a, T b) { return a->xgcd(b); };  // apila s y encima t (s a + t b = gcd)
+  ternary_operations["powmod"] = [](T a, T b, T c) { return a->powmod(b, c); };  // a^b mod c
 }
 
 /**
@@ -67,6 +80,22 @@ T Calculator<T>::Operate(std::vector<std::string> tokens_line) {
         T b = stack.top();
         stack.pop();
         stack.push(operations[token](b, a));
+      } else if (pair_operations.count(token) == 1 && stack.size() >= 2) {
+        T a = stack.top();
+        stack.pop();
+        T b = stack.top();
+        stack.pop();
+        std::pair<T, T> result = pair_operations[token](b, a);
+        stack.push(result.first);
+        stack.push(result.second);
+      } else if (ternary_operations.count(token) == 1 && stack.size() >= 3) {
+        T c = stack.top();
+        stack.pop();
+        T b = stack.top();
+        stack.pop();
+        T a = stack.top();
+        stack.pop();
+        stack.push(ternary_operations[token](a, b, c));
       } else if (unary_operations.count(token) == 1 && stack.size() >= 1) {
         T a = stack.top();
         stack.pop();
@@ -103,6 +132,18 @@ T Calculator<T>::Operate(std::vector<std::string> tokens_line) {
       stack.pop();
     }
     return Number::create(10, "0");
+  } catch (BigIntNotInvertible& e) {
+    std::cerr << e.what() << std::endl;
+    while (!stack.empty()) {
+      stack.pop();
+    }
+    return Number::create(10, "0");
+  } catch (BigIntOutOfRange& e) {
+    std::cerr << e.what() << std::endl;
+    while (!stack.empty()) {
+      stack.pop();
+    }
+    return Number::create(10, "0");
   }
 
   if (stack.size() != 1) {
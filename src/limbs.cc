@@ -0,0 +1,2836 @@
+/**
+ * @brief Código fuente de la clase Limbs declarada en el fichero limbs.h
+ *
+ */
+
+#ifndef LIMBS_CC
+#define LIMBS_CC
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../include/limbs.h"
+
+/**
+ * @brief Divide un valor de doble limb entre el radix de la base. Devuelve el cociente (acarreo) y
+ * deja en remainder el resto. El cociente debe caber en un limb
+ *
+ * @tparam Base
+ * @param value
+ * @param remainder
+ * @return Limb
+ */
+template <size_t Base>
+typename Limbs<Base>::Limb Limbs<Base>::SplitRadix(DoubleLimb value, Limb &remainder) {
+  if constexpr ((kRadix & (kRadix - 1)) == 0) {  // radix potencia de 2: desplazamientos
+    remainder = static_cast<Limb>(value % kRadix);
+    return static_cast<Limb>(value / kRadix);
+  } else {
+    return DivideNormalized(value, kRadixNormalized, kRadixInverse, kRadixShift, remainder);
+  }
+}
+
+/**
+ * @brief Divide un valor de doble limb entre un divisor del que se conoce el recíproco (algoritmo de
+ * Möller-Granlund): divisor_normalized = divisor << shift tiene el bit superior a 1 e inverse es
+ * floor((2^128 - 1) / divisor_normalized) - 2^64. El cociente debe caber en un limb
+ *
+ * @tparam Base
+ * @param value
+ * @param divisor_normalized
+ * @param inverse
+ * @param shift
+ * @param remainder
+ * @return Limb
+ */
+template <size_t Base>
+typename Limbs<Base>::Limb Limbs<Base>::DivideNormalized(DoubleLimb value, Limb divisor_normalized, Limb inverse,
+                                                         int shift, Limb &remainder) {
+  DoubleLimb shifted = value << shift;
+  Limb high = static_cast<Limb>(shifted >> 64);
+  Limb low = static_cast<Limb>(shifted);
+  DoubleLimb estimate = static_cast<DoubleLimb>(inverse) * high + shifted;
+  Limb quotient = static_cast<Limb>(estimate >> 64) + 1;
+  Limb rest = low - quotient * divisor_normalized;
+  // primera corrección sin saltos: se toma en la mitad de los casos y no es predecible
+  Limb mask = -static_cast<Limb>(rest > static_cast<Limb>(estimate));
+  quotient += mask;
+  rest += mask & divisor_normalized;
+  if (rest >= divisor_normalized) {
+    quotient++;
+    rest -= divisor_normalized;
+  }
+  remainder = rest >> shift;
+  return quotient;
+}
+
+/**
+ * @brief Calcula el recíproco de un divisor normalizado para DivideNormalized
+ *
+ * @tparam Base
+ * @param divisor_normalized
+ * @return Limb
+ */
+template <size_t Base>
+typename Limbs<Base>::Limb Limbs<Base>::Reciprocal(Limb divisor_normalized) {
+  return static_cast<Limb>(~static_cast<DoubleLimb>(0) / divisor_normalized - (static_cast<DoubleLimb>(1) << 64));
+}
+
+/**
+ * @brief Elimina los limbs nulos más significativos. El cero queda representado por un vector vacío
+ *
+ * @tparam Base
+ * @param limbs
+ */
+template <size_t Base>
+void Limbs<Base>::Trim(Vector &limbs) {
+  while (!limbs.empty() && limbs.back() == 0) {
+    limbs.pop_back();
+  }
+}
+
+/**
+ * @brief Comprueba que la magnitud sea 0
+ *
+ * @tparam Base
+ * @param limbs
+ * @return true
+ * @return false
+ */
+template <size_t Base>
+bool Limbs<Base>::IsZero(const Vector &limbs) {
+  for (size_t i = 0; i < limbs.size(); i++) {
+    if (limbs[i] != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Calcula Base^exponent para un exponente menor que kDigits
+ *
+ * @tparam Base
+ * @param exponent
+ * @return Limb
+ */
+template <size_t Base>
+typename Limbs<Base>::Limb Limbs<Base>::Power(size_t exponent) {
+  Limb power = 1;
+  for (size_t i = 0; i < exponent; i++) {
+    power *= Base;
+  }
+  return power;
+}
+
+/**
+ * @brief Devuelve el dígito de la posición indicada (0 es el menos significativo). Las posiciones
+ * más allá del último limb valen 0
+ *
+ * @tparam Base
+ * @param limbs
+ * @param position
+ * @return char
+ */
+template <size_t Base>
+char Limbs<Base>::Digit(const Vector &limbs, size_t position) {
+  size_t index = position / kDigits;
+  if (index >= limbs.size()) {
+    return 0;
+  }
+  return static_cast<char>((limbs[index] / Power(position % kDigits)) % Base);
+}
+
+/**
+ * @brief Número de dígitos significativos de la magnitud (0 para el cero)
+ *
+ * @tparam Base
+ * @param limbs
+ * @return size_t
+ */
+template <size_t Base>
+size_t Limbs<Base>::DigitCount(const Vector &limbs) {
+  size_t top = limbs.size();
+  while (top > 0 && limbs[top - 1] == 0) {
+    top--;
+  }
+  if (top == 0) {
+    return 0;
+  }
+  size_t count = (top - 1) * kDigits;
+  for (Limb value = limbs[top - 1]; value > 0; value /= Base) {
+    count++;
+  }
+  return count;
+}
+
+/**
+ * @brief Empaqueta un vector de dígitos (del menos al más significativo) en limbs
+ *
+ * @tparam Base
+ * @param digits
+ * @return Vector
+ */
+template <size_t Base>
+typename Limbs<Base>::Vector Limbs<Base>::FromDigits(const std::vector<char> &digits) {
+  Vector limbs((digits.size() + kDigits - 1) / kDigits, 0);
+  for (size_t i = 0; i < digits.size(); i++) {
+    limbs[i / kDigits] += static_cast<Limb>(digits[i]) * Power(i % kDigits);
+  }
+  Trim(limbs);
+  return limbs;
+}
+
+/**
+ * @brief Convierte la magnitud en un string con los dígitos del más al menos significativo. El
+ * limb superior se escribe sin ceros a la izquierda y el resto con exactamente kDigits dígitos
+ *
+ * @tparam Base
+ * @param limbs
+ * @return std::string
+ */
+template <size_t Base>
+std::string Limbs<Base>::ToString(const Vector &limbs) {
+  size_t count = DigitCount(limbs);
+  if (count == 0) {
+    return "0";
+  }
+  std::string number_str(count, '0');
+  Format(limbs, &number_str[0]);
+  return number_str;
+}
+
+/**
+ * @brief Lee una magnitud de length caracteres (del más al menos significativo, sin signo). Cada limb se
+ * forma con sus kDigits caracteres leídos de 8 en 8 con ParseChunk, y el resto uno a uno. Devuelve false
+ * (sin indicar la posición) si algún carácter no es un dígito válido de la base
+ *
+ * @tparam Base
+ * @param number_str
+ * @param length
+ * @param limbs
+ * @return true
+ * @return false
+ */
+template <size_t Base>
+bool Limbs<Base>::FromChars(const char *number_str, size_t length, Vector &limbs) {
+  limbs.assign((length + kDigits - 1) / kDigits, 0);
+  size_t end = length;
+  for (size_t i = 0; i < limbs.size(); i++) {
+    size_t count = std::min(end, kDigits);
+    if (!ParseLimb(number_str + end - count, count, limbs[i])) {
+      return false;
+    }
+    end -= count;
+  }
+  Trim(limbs);
+  return true;
+}
+
+/**
+ * @brief Escribe los DigitCount(limbs) dígitos de la magnitud en number_str, que debe tener ese tamaño.
+ * Los limbs completos se escriben de 8 en 8 dígitos con FormatChunk
+ *
+ * @tparam Base
+ * @param limbs
+ * @param number_str
+ */
+template <size_t Base>
+void Limbs<Base>::Format(const Vector &limbs, char *number_str) {
+  size_t size = limbs.size();
+  while (size > 0 && limbs[size - 1] == 0) {
+    size--;
+  }
+  if (size == 0) {
+    return;
+  }
+  size_t count = DigitCount(limbs);
+  size_t position = count;
+  for (size_t i = 0; i + 1 < size; i++) {
+    position -= kDigits;
+    FormatLimb(limbs[i], kDigits, number_str + position);
+  }
+  FormatLimb(limbs[size - 1], position, number_str);
+}
+
+/**
+ * @brief Compara 2 magnitudes. Devuelve -1, 0 o 1 si la primera es menor, igual o mayor
+ *
+ * @tparam Base
+ * @param number_x
+ * @param number_y
+ * @return int
+ */
+template <size_t Base>
+int Limbs<Base>::Compare(const Vector &number_x, const Vector &number_y) {
+  size_t size_x = number_x.size();
+  size_t size_y = number_y.size();
+  while (size_x > 0 && number_x[size_x - 1] == 0) size_x--;
+  while (size_y > 0 && number_y[size_y - 1] == 0) size_y--;
+  if (size_x != size_y) {
+    return size_x > size_y ? 1 : -1;
+  }
+  for (size_t i = size_x; i > 0; i--) {
+    if (number_x[i - 1] != number_y[i - 1]) {
+      return number_x[i - 1] > number_y[i - 1] ? 1 : -1;
+    }
+  }
+  return 0;
+}
+
+/**
+ * @brief Suma 2 magnitudes de cualquier longitud en una sola pasada: se suma la parte común, en la cola
+ * del operando mayor solo se propaga el acarreo y, en cuanto se anula, el resto se copia tal cual
+ *
+ * @tparam Base
+ * @param number_x
+ * @param number_y
+ * @return Vector
+ */
+template <size_t Base>
+typename Limbs<Base>::Vector Limbs<Base>::Add(const Vector &number_x, const Vector &number_y) {
+  const Vector &longer = number_x.size() >= number_y.size() ? number_x : number_y;
+  const Vector &shorter = number_x.size() >= number_y.size() ? number_y : number_x;
+  size_t size_long = longer.size();
+  size_t size_short = shorter.size();
+  Vector sum(size_long + 1);
+  Limb carry = 0;
+  size_t i = 0;
+  for (; i < size_short; i++) {
+    DoubleLimb digit = static_cast<DoubleLimb>(longer[i]) + shorter[i] + carry;
+    carry = digit >= kRadix ? 1 : 0;
+    sum[i] = static_cast<Limb>(carry ? digit - kRadix : digit);
+  }
+  for (; i < size_long && carry != 0; i++) {
+    DoubleLimb digit = static_cast<DoubleLimb>(longer[i]) + 1;
+    carry = digit >= kRadix ? 1 : 0;
+    sum[i] = static_cast<Limb>(carry ? digit - kRadix : digit);
+  }
+  std::copy(longer.begin() + i, longer.end(), sum.begin() + i);
+  sum[size_long] = carry;
+  Trim(sum);
+  return sum;
+}
+
+/**
+ * @brief Resta 2 magnitudes. La primera debe ser mayor o igual que la segunda. Igual que en la suma,
+ * tras la parte común solo se propaga el préstamo y el resto del minuendo se copia
+ *
+ * @tparam Base
+ * @param number_x
+ * @param number_y
+ * @return Vector
+ */
+template <size_t Base>
+typename Limbs<Base>::Vector Limbs<Base>::Subtract(const Vector &number_x, const Vector &number_y) {
+  size_t size_x = number_x.size();
+  size_t size_y = std::min(number_y.size(), size_x);
+  Vector difference(size_x);
+  Limb borrow = 0;
+  size_t i = 0;
+  for (; i < size_y; i++) {
+    DoubleLimb subtrahend = static_cast<DoubleLimb>(number_y[i]) + borrow;
+    borrow = number_x[i] < subtrahend ? 1 : 0;
+    difference[i] = static_cast<Limb>((borrow ? number_x[i] + kRadix : number_x[i]) - subtrahend);
+  }
+  for (; i < size_x && borrow != 0; i++) {
+    borrow = number_x[i] == 0 ? 1 : 0;
+    difference[i] = static_cast<Limb>(borrow ? kRadix - 1 : number_x[i] - 1);
+  }
+  std::copy(number_x.begin() + i, number_x.end(), difference.begin() + i);
+  Trim(difference);
+  return difference;
+}
+
+/**
+ * @brief Multiplica 2 magnitudes. Según el tamaño de los operandos se elige el algoritmo clásico
+ * (schoolbook), Karatsuba, Toom-Cook o la NTT
+ *
+ * @tparam Base
+ * @param number_x
+ * @param number_y
+ * @return Vector
+ */
+template <size_t Base>
+typename Limbs<Base>::Vector Limbs<Base>::Multiply(const Vector &number_x, const Vector &number_y) {
+  if (IsZero(number_x) || IsZero(number_y)) {
+    return Vector();
+  }
+  Vector product(number_x.size() + number_y.size(), 0);
+  Multiply(product.data(), number_x.data(), number_x.size(), number_y.data(), number_y.size());
+  Trim(product);
+  return product;
+}
+
+/**
+ * @brief Eleva una magnitud al cuadrado con el selector de cuadrados
+ *
+ * @tparam Base
+ * @param number
+ * @return Vector
+ */
+template <size_t Base>
+typename Limbs<Base>::Vector Limbs<Base>::Square(const Vector &number) {
+  if (IsZero(number)) {
+    return Vector();
+  }
+  Vector square(2 * number.size(), 0);
+  Square(square.data(), number.data(), number.size());
+  Trim(square);
+  return square;
+}
+
+/**
+ * @brief Potencia de una magnitud con la ventana deslizante y el selector de cuadrados
+ *
+ * @tparam Base
+ * @param number
+ * @param exponent
+ * @return Vector
+ */
+template <size_t Base>
+typename Limbs<Base>::Vector Limbs<Base>::Pow(const Vector &number, const Vector &exponent) {
+  Vector bits = exponent;
+  Trim(bits);
+  if (bits.empty()) {
+    return Vector(1, 1);
+  }
+  if (IsZero(number)) {
+    return Vector();
+  }
+  return SlidingWindow(number, bits, [](const Vector &value) { return Square(value); },
+                       [](const Vector &value_x, const Vector &value_y) { return Multiply(value_x, value_y); });
+}
+
+/**
+ * @brief Potencia modular x^e mod m sin construir x^e. Con radix 2^64 y módulo impar se trabaja en forma
+ * de Montgomery (cada producto se reduce con n pasos de un limb en lugar de una división); con módulo par
+ * cada producto se reduce con Barrett. El resto de radix no son coprimos con todos los módulos impares,
+ * así que pasan por binario
+ *
+ * @tparam Base
+ * @param number
+ * @param exponent
+ * @param modulus
+ * @return Vector
+ */
+template <size_t Base>
+typename Limbs<Base>::Vector Limbs<Base>::PowMod(const Vector &number, const Vector &exponent,
+                                                 const Vector &modulus) {
+  if constexpr (kRadixBits != 64) {
+    return FromBinary(Limbs<2>::PowMod(ToBinary(number), exponent, ToBinary(modulus)));
+  } else {
+    Vector divisor = modulus, bits = exponent, quotient, base;
+    Trim(divisor);
+    Trim(bits);
+    if (divisor.size() == 1 && divisor[0] == 1) {
+      return Vector();
+    }
+    if (bits.empty()) {
+      return Vector(1, 1);
+    }
+    Divide(number, divisor, quotient, base);
+    Trim(base);
+    if (base.empty()) {
+      return Vector();
+    }
+    if ((divisor[0] & 1) == 0) {
+      Barrett reducer = MakeBarrett(divisor);
+      return SlidingWindow(
+          base, bits, [&reducer](const Vector &value) { return Reduce(Square(value), reducer); },
+          [&reducer](const Vector &value_x, const Vector &value_y) {
+            return Reduce(Multiply(value_x, value_y), reducer);
+          });
+    }
+    Montgomery context = MakeMontgomery(divisor);
+    Vector power = SlidingWindow(
+        ToMontgomery(base, context), bits,
+        [&context](const Vector &value) { return MontgomeryMultiply(value, value, context); },
+        [&context](const Vector &value_x, const Vector &value_y) {
+          return MontgomeryMultiply(value_x, value_y, context);
+        });
+    // salida de la forma de Montgomery: power * 1 / R
+    power.resize(2 * divisor.size() + 1, 0);
+    Vector result = MontgomeryReduce(power, context);
+    Trim(result);
+    return result;
+  }
+}
+
+/**
+ * @brief Ventana deslizante de izquierda a derecha. Los bits del exponente (en binario, limbs de 64 bits,
+ * sin ceros por la izquierda) se leen directamente; se precalculan las potencias impares number^1,
+ * number^3, ..., number^(2^w - 1) y cada ventana que empieza y acaba en un 1 cuesta un producto, mientras
+ * que cada bit cuesta un cuadrado. Sirve tanto para la potencia entera como para la modular
+ *
+ * @tparam Base
+ * @tparam SquareOperation
+ * @tparam MultiplyOperation
+ * @param number
+ * @param exponent
+ * @param square
+ * @param multiply
+ * @return Vector
+ */
+template <size_t Base>
+template <class SquareOperation, class MultiplyOperation>
+typename Limbs<Base>::Vector Limbs<Base>::SlidingWindow(const Vector &number, const Vector &exponent,
+                                                        SquareOperation square, MultiplyOperation multiply) {
+  size_t bits = 64 * exponent.size() - __builtin_clzll(exponent.back());
+  auto bit = [&exponent](size_t position) { return (exponent[position / 64] >> (position % 64)) & 1; };
+  // tamaño de la ventana según la longitud del exponente
+  static constexpr size_t kWindowLimits[] = {0, 8, 24, 80, 240, 672};
+  size_t window = 1;
+  while (window < 6 && bits > kWindowLimits[window]) {
+    window++;
+  }
+  std::vector<Vector> odd_powers(static_cast<size_t>(1) << (window - 1));
+  odd_powers[0] = number;
+  if (odd_powers.size() > 1) {
+    Vector number_square = square(number);
+    for (size_t i = 1; i < odd_powers.size(); i++) {
+      odd_powers[i] = multiply(odd_powers[i - 1], number_square);
+    }
+  }
+  Vector result;
+  bool started = false;
+  size_t position = bits;
+  while (position > 0) {
+    if (bit(position - 1) == 0) {
+      result = square(result);
+      position--;
+      continue;
+    }
+    // ventana [low, position): empieza en el bit actual (un 1) y acaba en el 1 más bajo posible
+    size_t low = position > window ? position - window : 0;
+    while (bit(low) == 0) {
+      low++;
+    }
+    size_t value = 0;
+    for (size_t i = position; i > low; i--) {
+      value = (value << 1) | bit(i - 1);
+    }
+    if (started) {
+      for (size_t i = low; i < position; i++) {
+        result = square(result);
+      }
+      result = multiply(result, odd_powers[value / 2]);
+    } else {
+      result = odd_powers[value / 2];
+      started = true;
+    }
+    position = low;
+  }
+  return result;
+}
+
+/**
+ * @brief Prepara un módulo impar (sin ceros por la izquierda) para la aritmética de Montgomery: -m^-1 mod
+ * 2^64 por iteraciones de Newton, cada una de las cuales duplica los bits correctos
+ *
+ * @tparam Base
+ * @param modulus
+ * @return Montgomery
+ */
+template <size_t Base>
+typename Limbs<Base>::Montgomery Limbs<Base>::MakeMontgomery(const Vector &modulus) {
+  Montgomery context;
+  context.modulus = modulus;
+  Limb inverse = modulus[0];  // correcto en los 3 bits inferiores para cualquier impar
+  for (int i = 0; i < 5; i++) {
+    inverse *= 2 - modulus[0] * inverse;
+  }
+  context.inverse = -inverse;
+  return context;
+}
+
+/**
+ * @brief Pasa a forma de Montgomery (x * R mod m) un valor menor que el módulo
+ *
+ * @tparam Base
+ * @param number
+ * @param context
+ * @return Vector
+ */
+template <size_t Base>
+typename Limbs<Base>::Vector Limbs<Base>::ToMontgomery(const Vector &number, const Montgomery &context) {
+  Vector shifted(context.modulus.size(), 0), quotient, remainder;
+  shifted.insert(shifted.end(), number.begin(), number.end());
+  Divide(shifted, context.modulus, quotient, remainder);
+  remainder.resize(context.modulus.size(), 0);
+  return remainder;
+}
+
+/**
+ * @brief Reducción de Montgomery multiprecisión (REDC): devuelve product / R mod m para product < m * R.
+ * product debe tener 2n + 1 limbs y se usa como espacio de trabajo; cada paso anula su limb inferior
+ * sumando un múltiplo del módulo, y al final basta con una resta condicional
+ *
+ * @tparam Base
+ * @param product
+ * @param context
+ * @return Vector
+ */
+template <size_t Base>
+typename Limbs<Base>::Vector Limbs<Base>::MontgomeryReduce(Vector &product, const Montgomery &context) {
+  const size_t size = context.modulus.size();
+  const Limb *modulus = context.modulus.data();
+  for (size_t i = 0; i < size; i++) {
+    Limb factor = product[i] * context.inverse;
+    Limb carry = 0;
+    for (size_t j = 0; j < size; j++) {
+      DoubleLimb sum = static_cast<DoubleLimb>(factor) * modulus[j] + product[i + j] + carry;
+      product[i + j] = static_cast<Limb>(sum);
+      carry = static_cast<Limb>(sum >> 64);
+    }
+    AddTo(product.data() + i + size, product.size() - i - size, &carry, 1);
+  }
+  // el resultado (n + 1 limbs) es menor que 2m
+  Limb *high = product.data() + size;
+  size_t i = size;
+  while (i > 0 && high[i - 1] == modulus[i - 1]) {
+    i--;
+  }
+  if (high[size] != 0 || i == 0 || high[i - 1] > modulus[i - 1]) {
+    SubtractFrom(high, size + 1, modulus, size);
+  }
+  return Vector(high, high + size);
+}
+
+/**
+ * @brief Producto de Montgomery x * y / R mod m de 2 valores en forma de Montgomery. El producto usa el
+ * selector de multiplicación (o el de cuadrados si x e y son el mismo vector)
+ *
+ * @tparam Base
+ * @param number_x
+ * @param number_y
+ * @param context
+ * @return Vector
+ */
+template <size_t Base>
+typename Limbs<Base>::Vector Limbs<Base>::MontgomeryMultiply(const Vector &number_x, const Vector &number_y,
+                                                             const Montgomery &context) {
+  const size_t size = context.modulus.size();
+  Vector product(2 * size + 1, 0);
+  Multiply(product.data(), number_x.data(), size, number_y.data(), size);
+  return MontgomeryReduce(product, context);
+}
+
+/**
+ * @brief Factorial n! por el método de prime-swing de Luschny: n! = ((n/2)!)^2 * swing(n), donde el
+ * exponente de cada primo p en swing(n) es la suma de floor(n / p^k) mod 2. Se calcula la parte impar y
+ * los factores 2 (n - popcount(n) en total) se añaden al final; los factores de cada swing se multiplican
+ * con un árbol equilibrado para aprovechar la multiplicación rápida. Con radix potencia de 2 se calcula en
+ * binario y se reagrupan los bits; en base 10 se calcula directamente en su radix, porque el cambio de base
+ * de un resultado tan grande costaría mucho más que el propio factorial
+ *
+ * @tparam Base
+ * @param n
+ * @return Vector
+ */
+template <size_t Base>
+typename Limbs<Base>::Vector Limbs<Base>::Factorial(uint64_t n) {
+  if constexpr (kRadixBits != 0 && Base != 2) {
+    return FromBinary(Limbs<2>::Factorial(n));
+  } else {
+    // criba de Eratóstenes con los primos impares hasta n
+    std::vector<Limb> primes;
+    std::vector<bool> composite(n / 2 + 1, false);
+    for (Limb p = 3; p <= n; p += 2) {
+      if (composite[p / 2]) {
+        continue;
+      }
+      primes.push_back(p);
+      for (Limb multiple = p * p; multiple <= n; multiple += 2 * p) {
+        composite[multiple / 2] = true;
+      }
+    }
+    Vector result = OddFactorial(n, primes);
+    Limb twos = n - __builtin_popcountll(n);
+    if constexpr (Base == 2) {
+      ShiftLeft(result, twos);
+    } else {
+      result = Multiply(result, Pow(Vector(1, 2), Vector(1, twos)));
+    }
+    return result;
+  }
+}
+
+/**
+ * @brief Parte impar de n!: la parte impar de (n/2)! al cuadrado por la de swing(n)
+ *
+ * @tparam Base
+ * @param n
+ * @param primes primos impares hasta al menos n, en orden
+ * @return Vector
+ */
+template <size_t Base>
+typename Limbs<Base>::Vector Limbs<Base>::OddFactorial(uint64_t n, const std::vector<Limb> &primes) {
+  if (n < 3) {
+    return Vector(1, 1);
+  }
+  Vector result = Square(OddFactorial(n / 2, primes));
+  // factores de swing(n) agrupados en limbs (menores que el radix)
+  std::vector<Limb> factors;
+  Limb factor = 1;
+  for (size_t i = 0; i < primes.size() && primes[i] <= n; i++) {
+    unsigned exponent = 0;
+    for (uint64_t quotient = n; quotient >= primes[i];) {
+      quotient /= primes[i];
+      exponent += quotient & 1;
+    }
+    for (; exponent > 0; exponent--) {
+      Limb product;
+      if (__builtin_mul_overflow(factor, primes[i], &product) || product >= kRadix) {
+        factors.push_back(factor);
+        product = primes[i];
+      }
+      factor = product;
+    }
+  }
+  factors.push_back(factor);
+  return Multiply(result, Product(factors.data(), factors.size()));
+}
+
+/**
+ * @brief Producto de una lista de limbs con un árbol equilibrado: las 2 mitades se multiplican por
+ * separado y después entre sí, de forma que los productos grandes son de operandos del mismo tamaño
+ *
+ * @tparam Base
+ * @param factors
+ * @param count
+ * @return Vector
+ */
+template <size_t Base>
+typename Limbs<Base>::Vector Limbs<Base>::Product(const Limb *factors, size_t count) {
+  if (count <= 16) {
+    Vector product(1, 1);
+    for (size_t i = 0; i < count; i++) {
+      MultiplySmall(product, factors[i], 0);
+    }
+    return product;
+  }
+  size_t half = count / 2;
+  return Multiply(Product(factors, half), Product(factors + half, count - half));
+}
+
+/**
+ * @brief Máximo común divisor de 2 magnitudes. Con radix 2^64 se reduce con EuclidReduce (half-gcd para
+ * operandos grandes, pasos de Lehmer y Stein al final); el resto de radix pasan por binario
+ *
+ * @tparam Base
+ * @param number_x
+ * @param number_y
+ * @return Vector
+ */
+template <size_t Base>
+typename Limbs<Base>::Vector Limbs<Base>::Gcd(const Vector &number_x, const Vector &number_y) {
+  if constexpr (kRadixBits != 64) {
+    return FromBinary(Limbs<2>::Gcd(ToBinary(number_x), ToBinary(number_y)));
+  } else {
+    Vector a = number_x, b = number_y;
+    Trim(a);
+    Trim(b);
+    if (Compare(a, b) < 0) {
+      a.swap(b);
+    }
+    EuclidReduce(a, b, nullptr);
+    return a;
+  }
+}
+
+/**
+ * @brief Máximo común divisor g con los cofactores de Bézout, g = s x + t y. Se reduce igual que en Gcd
+ * acumulando la matriz de los pasos, y el cofactor de x se lleva después a su representante de menor valor
+ * absoluto módulo y / g (con empate, el positivo), de forma que t = (g - s x) / y es exacto. Si y es 0 los
+ * cofactores son (1, 0), y (0, 0) si también lo es x
+ *
+ * @tparam Base
+ * @param number_x
+ * @param number_y
+ * @param s magnitud del cofactor de x
+ * @param s_negative signo del cofactor de x
+ * @param t magnitud del cofactor de y
+ * @param t_negative signo del cofactor de y
+ * @return Vector
+ */
+template <size_t Base>
+typename Limbs<Base>::Vector Limbs<Base>::ExtendedGcd(const Vector &number_x, const Vector &number_y, Vector &s,
+                                                      bool &s_negative, Vector &t, bool &t_negative) {
+  if constexpr (kRadixBits != 64) {
+    Vector s_binary, t_binary;
+    Vector gcd = Limbs<2>::ExtendedGcd(ToBinary(number_x), ToBinary(number_y), s_binary, s_negative, t_binary,
+                                       t_negative);
+    s = FromBinary(s_binary);
+    t = FromBinary(t_binary);
+    return FromBinary(gcd);
+  } else {
+    Vector x = number_x, y = number_y;
+    Trim(x);
+    Trim(y);
+    s_negative = t_negative = false;
+    t.clear();
+    if (y.empty()) {
+      s = x.empty() ? Vector() : Vector(1, 1);
+      return x;
+    }
+    // se reduce con el mayor delante; el cofactor de x es la columna que le corresponde
+    bool swapped = Compare(x, y) < 0;
+    Vector a = swapped ? y : x, b = swapped ? x : y;
+    Matrix matrix = Identity();
+    EuclidReduce(a, b, &matrix);
+    const Signed &cofactor = swapped ? matrix.m01 : matrix.m00;
+
+    // s = cofactor mod (y / g), en (-(y / g) / 2, (y / g) / 2]
+    Vector reduced, quotient, remainder;
+    Divide(y, a, reduced, remainder);
+    s.clear();
+    if (!cofactor.magnitude.empty()) {
+      Divide(cofactor.magnitude, reduced, quotient, s);
+      Trim(s);
+    }
+    if (cofactor.negative && !s.empty()) {
+      s = Subtract(reduced, s);
+    }
+    Vector twice = Add(s, s);
+    if (Compare(twice, reduced) > 0) {
+      s = Subtract(reduced, s);
+      s_negative = true;
+    }
+
+    // t = (g - s x) / y, división exacta
+    Vector numerator = Multiply(s, x);
+    bool numerator_negative = !s_negative && !numerator.empty();
+    Accumulate(numerator, numerator_negative, a, false);
+    Divide(numerator, y, t, remainder);
+    Trim(t);
+    t_negative = numerator_negative && !t.empty();
+    return a;
+  }
+}
+
+/**
+ * @brief Matriz identidad (ningún paso de reducción)
+ *
+ * @tparam Base
+ * @return Matrix
+ */
+template <size_t Base>
+typename Limbs<Base>::Matrix Limbs<Base>::Identity() {
+  Matrix identity;
+  identity.m00.magnitude.assign(1, 1);
+  identity.m11.magnitude.assign(1, 1);
+  return identity;
+}
+
+/**
+ * @brief Producto de 2 matrices de reducción: primero se aplica matrix_y y después matrix_x
+ *
+ * @tparam Base
+ * @param matrix_x
+ * @param matrix_y
+ * @return Matrix
+ */
+template <size_t Base>
+typename Limbs<Base>::Matrix Limbs<Base>::MultiplyMatrix(const Matrix &matrix_x, const Matrix &matrix_y) {
+  Matrix product;
+  product.m00 = MultiplySigned(matrix_x.m00, matrix_y.m00);
+  AddSigned(product.m00, MultiplySigned(matrix_x.m01, matrix_y.m10), false);
+  product.m01 = MultiplySigned(matrix_x.m00, matrix_y.m01);
+  AddSigned(product.m01, MultiplySigned(matrix_x.m01, matrix_y.m11), false);
+  product.m10 = MultiplySigned(matrix_x.m10, matrix_y.m00);
+  AddSigned(product.m10, MultiplySigned(matrix_x.m11, matrix_y.m10), false);
+  product.m11 = MultiplySigned(matrix_x.m10, matrix_y.m01);
+  AddSigned(product.m11, MultiplySigned(matrix_x.m11, matrix_y.m11), false);
+  return product;
+}
+
+/**
+ * @brief Aplica a los valores completos la matriz calculada sobre sus limbs superiores. Cerca del final de
+ * esa reducción los limbs inferiores pueden dejar un valor negativo o desordenado; se corrige cambiando de
+ * signo o intercambiando las filas de la matriz, que sigue siendo unimodular y no cambia el mcd
+ *
+ * @tparam Base
+ * @param a
+ * @param b
+ * @param matrix
+ */
+template <size_t Base>
+void Limbs<Base>::ApplyMatrix(Vector &a, Vector &b, Matrix &matrix) {
+  Signed value_a, value_b;
+  value_a.magnitude = a;
+  value_b.magnitude = b;
+  Signed first = MultiplySigned(matrix.m00, value_a);
+  AddSigned(first, MultiplySigned(matrix.m01, value_b), false);
+  Signed second = MultiplySigned(matrix.m10, value_a);
+  AddSigned(second, MultiplySigned(matrix.m11, value_b), false);
+  if (first.negative) {
+    matrix.m00.negative = !matrix.m00.negative && !matrix.m00.magnitude.empty();
+    matrix.m01.negative = !matrix.m01.negative && !matrix.m01.magnitude.empty();
+  }
+  if (second.negative) {
+    matrix.m10.negative = !matrix.m10.negative && !matrix.m10.magnitude.empty();
+    matrix.m11.negative = !matrix.m11.negative && !matrix.m11.magnitude.empty();
+  }
+  a.swap(first.magnitude);
+  b.swap(second.magnitude);
+  if (Compare(a, b) < 0) {
+    a.swap(b);
+    std::swap(matrix.m00, matrix.m10);
+    std::swap(matrix.m01, matrix.m11);
+  }
+}
+
+/**
+ * @brief Multiplica por la izquierda la matriz de reducción por la de un paso de Lehmer (A B; C D):
+ * fila 0 = A fila 0 + B fila 1 y fila 1 = C fila 0 + D fila 1
+ *
+ * @tparam Base
+ * @param matrix
+ * @param A
+ * @param B
+ * @param C
+ * @param D
+ */
+template <size_t Base>
+void Limbs<Base>::CombineRows(Matrix &matrix, long A, long B, long C, long D) {
+  auto combine = [](const Signed &value_x, long factor_x, const Signed &value_y, long factor_y) {
+    Signed result, term;
+    if (factor_x != 0) {
+      result = value_x;
+      ScaleSigned(result, factor_x < 0 ? -factor_x : factor_x);
+      result.negative = !result.magnitude.empty() && value_x.negative != (factor_x < 0);
+    }
+    if (factor_y != 0) {
+      term = value_y;
+      ScaleSigned(term, factor_y < 0 ? -factor_y : factor_y);
+      term.negative = !term.magnitude.empty() && value_y.negative != (factor_y < 0);
+      AddSigned(result, term, false);
+    }
+    return result;
+  };
+  Signed m00 = combine(matrix.m00, A, matrix.m10, B);
+  Signed m01 = combine(matrix.m01, A, matrix.m11, B);
+  matrix.m10 = combine(matrix.m00, C, matrix.m10, D);
+  matrix.m11 = combine(matrix.m01, C, matrix.m11, D);
+  matrix.m00 = std::move(m00);
+  matrix.m01 = std::move(m01);
+}
+
+/**
+ * @brief Reduce (a, b), con a >= b, hasta que b es 0 y a es el mcd. Mientras b tiene al menos
+ * kHalfGcdThreshold limbs cada ronda es un half-gcd seguido de un paso de Euclides; después, pasos de
+ * Lehmer, y sin matriz que acumular el último limb se termina con el algoritmo binario
+ *
+ * @tparam Base
+ * @param a
+ * @param b
+ * @param matrix matriz acumulada (nullptr si no hacen falta los cofactores)
+ */
+template <size_t Base>
+void Limbs<Base>::EuclidReduce(Vector &a, Vector &b, Matrix *matrix) {
+  while (!b.empty()) {
+    if (b.size() >= kHalfGcdThreshold) {
+      Matrix step;
+      HalfGcd(a, b, step);
+      if (matrix != nullptr) {
+        *matrix = MultiplyMatrix(step, *matrix);
+      }
+      if (!b.empty()) {
+        EuclidStep(a, b, matrix);
+      }
+    } else if (matrix == nullptr && a.size() == 1) {
+      a[0] = BinaryGcd(a[0], b[0]);
+      b.clear();
+    } else {
+      LehmerStep(a, b, matrix);
+    }
+  }
+}
+
+/**
+ * @brief Half-gcd recursivo: reduce (a, b), con a >= b y n limbs, hasta que b tiene como mucho n / 2 + 1
+ * limbs, y deja en matrix los pasos aplicados. Primero se reducen recursivamente los limbs superiores (la
+ * mitad alta del número) y se aplica la matriz al valor completo; tras un paso de Euclides, una segunda
+ * recursión sobre los limbs superiores que quedan lleva b hasta cerca del objetivo, y los últimos pasos son
+ * de Lehmer. Cada recursión trabaja con la mitad de limbs, así que el coste es O(M(n) log n)
+ *
+ * @tparam Base
+ * @param a
+ * @param b
+ * @param matrix
+ */
+template <size_t Base>
+void Limbs<Base>::HalfGcd(Vector &a, Vector &b, Matrix &matrix) {
+  matrix = Identity();
+  const size_t target = a.size() / 2 + 1;
+  if (b.size() <= target) {
+    return;
+  }
+  if (a.size() >= kHalfGcdThreshold) {
+    Vector high_a = Slice(a, target, a.size()), high_b = Slice(b, target, a.size());
+    HalfGcd(high_a, high_b, matrix);
+    ApplyMatrix(a, b, matrix);
+    if (b.size() > target) {
+      EuclidStep(a, b, &matrix);
+    }
+    if (b.size() > target) {
+      // los 2 (a.size() - target) limbs superiores se reducen a la mitad: b queda en unos target limbs
+      size_t shift = 2 * target - a.size();
+      Matrix step;
+      high_a = Slice(a, shift, a.size());
+      high_b = Slice(b, shift, a.size());
+      HalfGcd(high_a, high_b, step);
+      ApplyMatrix(a, b, step);
+      matrix = MultiplyMatrix(step, matrix);
+    }
+  }
+  while (b.size() > target) {
+    LehmerStep(a, b, &matrix);
+  }
+}
+
+/**
+ * @brief Paso de Lehmer (algoritmo L de Knuth): los cocientes de Euclides se simulan con los 62 bits
+ * superiores de a y b (con el mismo desplazamiento) mientras los 2 cocientes extremos coinciden, y la
+ * matriz resultante se aplica de una pasada sobre los limbs. Si no se acepta ningún cociente se hace un
+ * paso de Euclides completo
+ *
+ * @tparam Base
+ * @param a
+ * @param b
+ * @param matrix matriz acumulada (nullptr si no hacen falta los cofactores)
+ */
+template <size_t Base>
+void Limbs<Base>::LehmerStep(Vector &a, Vector &b, Matrix *matrix) {
+  const size_t bits = 64 * a.size() - __builtin_clzll(a.back());
+  const size_t shift = bits > 62 ? bits - 62 : 0;
+  auto top = [shift](const Vector &number) {
+    size_t index = shift / 64;
+    unsigned offset = shift % 64;
+    if (index >= number.size()) {
+      return 0L;
+    }
+    Limb value = number[index] >> offset;
+    if (offset != 0 && index + 1 < number.size()) {
+      value |= number[index + 1] << (64 - offset);
+    }
+    return static_cast<long>(value);
+  };
+  long x = top(a), y = top(b);
+  long A = 1, B = 0, C = 0, D = 1;
+  while (y + C != 0 && y + D != 0) {
+    long q = (x + A) / (y + C);
+    if (q != (x + B) / (y + D)) {
+      break;
+    }
+    long next = A - q * C;
+    A = C;
+    C = next;
+    next = B - q * D;
+    B = D;
+    D = next;
+    next = x - q * y;
+    x = y;
+    y = next;
+  }
+  if (B == 0) {
+    EuclidStep(a, b, matrix);
+    return;
+  }
+  // (a, b) = (A a + B b, C a + D b), con acarreos con signo
+  b.resize(a.size(), 0);
+  __int128 carry_a = 0, carry_b = 0;
+  for (size_t i = 0; i < a.size(); i++) {
+    __int128 value_a = static_cast<__int128>(a[i]), value_b = static_cast<__int128>(b[i]);
+    carry_a += A * value_a + B * value_b;
+    carry_b += C * value_a + D * value_b;
+    a[i] = static_cast<Limb>(carry_a);
+    b[i] = static_cast<Limb>(carry_b);
+    carry_a >>= 64;
+    carry_b >>= 64;
+  }
+  Trim(a);
+  Trim(b);
+  if (matrix != nullptr) {
+    CombineRows(*matrix, A, B, C, D);
+  }
+}
+
+/**
+ * @brief Paso de Euclides completo: (a, b) = (b, a mod b)
+ *
+ * @tparam Base
+ * @param a
+ * @param b
+ * @param matrix matriz acumulada (nullptr si no hacen falta los cofactores)
+ */
+template <size_t Base>
+void Limbs<Base>::EuclidStep(Vector &a, Vector &b, Matrix *matrix) {
+  Vector quotient, remainder;
+  Divide(a, b, quotient, remainder);
+  Trim(remainder);
+  a.swap(b);
+  b.swap(remainder);
+  if (matrix != nullptr) {
+    Signed quotient_signed;
+    quotient_signed.magnitude = quotient;
+    Signed m10 = matrix->m00, m11 = matrix->m01;
+    AddSigned(m10, MultiplySigned(quotient_signed, matrix->m10), true);
+    AddSigned(m11, MultiplySigned(quotient_signed, matrix->m11), true);
+    matrix->m00 = std::move(matrix->m10);
+    matrix->m01 = std::move(matrix->m11);
+    matrix->m10 = std::move(m10);
+    matrix->m11 = std::move(m11);
+  }
+}
+
+/**
+ * @brief Máximo común divisor de 2 limbs con el algoritmo binario de Stein: se quitan los factores 2
+ * comunes y se resta el menor del mayor, que siempre deja un número par
+ *
+ * @tparam Base
+ * @param a
+ * @param b
+ * @return Limb
+ */
+template <size_t Base>
+typename Limbs<Base>::Limb Limbs<Base>::BinaryGcd(Limb a, Limb b) {
+  if (a == 0 || b == 0) {
+    return a | b;
+  }
+  int twos = __builtin_ctzll(a | b);
+  a >>= __builtin_ctzll(a);
+  while (b != 0) {
+    b >>= __builtin_ctzll(b);
+    if (a > b) {
+      std::swap(a, b);
+    }
+    b -= a;
+  }
+  return a << twos;
+}
+
+/**
+ * @brief Selector del algoritmo de multiplicación (schoolbook, Karatsuba, Toom-3, Toom-4 o NTT según el
+ * tamaño del operando menor). Por debajo de la NTT, los operandos muy desiguales se trocean en bloques del
+ * tamaño del menor para que los algoritmos de división en partes trabajen siempre con operandos equilibrados
+ *
+ * @tparam Base
+ * @param result
+ * @param number_x
+ * @param size_x
+ * @param number_y
+ * @param size_y
+ */
+template <size_t Base>
+void Limbs<Base>::Multiply(Limb *result, const Limb *number_x, size_t size_x, const Limb *number_y,
+                           size_t size_y) {
+  if (number_x == number_y && size_x == size_y) {  // los operandos son el mismo: cuadrado
+    Square(result, number_x, size_x);
+    return;
+  }
+  if (size_x < size_y) {
+    std::swap(number_x, number_y);
+    std::swap(size_x, size_y);
+  }
+  if (size_y < kKaratsubaThreshold) {
+    MultiplyBasecase(result, number_x, size_x, number_y, size_y);
+    return;
+  }
+  if (size_y >= kNttThreshold) {
+    MultiplyNtt(result, number_x, size_x, number_y, size_y);
+    return;
+  }
+  if (size_y > (size_x + 1) / 2) {
+    if (size_y >= kToom4Threshold) {
+      MultiplyToom4(result, number_x, size_x, number_y, size_y);
+    } else if (size_y >= kToom3Threshold) {
+      MultiplyToom3(result, number_x, size_x, number_y, size_y);
+    } else {
+      MultiplyKaratsuba(result, number_x, size_x, number_y, size_y);
+    }
+    return;
+  }
+  // operandos desequilibrados: se multiplica cada bloque de size_y limbs y se acumula
+  std::fill(result, result + size_x + size_y, 0);
+  Vector partial(2 * size_y);
+  for (size_t offset = 0; offset < size_x; offset += size_y) {
+    size_t length = std::min(size_y, size_x - offset);
+    Multiply(partial.data(), number_x + offset, length, number_y, size_y);
+    AddTo(result + offset, size_x + size_y - offset, partial.data(), length + size_y);
+  }
+}
+
+/**
+ * @brief Selector del algoritmo de cuadrado. Por debajo de Toom se usan las versiones específicas
+ * (schoolbook con la mitad de productos y Karatsuba con 3 cuadrados); Toom-Cook y la NTT detectan que
+ * los operandos son el mismo y evalúan o transforman una sola vez
+ *
+ * @tparam Base
+ * @param result
+ * @param number
+ * @param size
+ */
+template <size_t Base>
+void Limbs<Base>::Square(Limb *result, const Limb *number, size_t size) {
+  if (size < kKaratsubaSquareThreshold) {
+    SquareBasecase(result, number, size);
+  } else if (size >= kNttThreshold) {
+    MultiplyNtt(result, number, size, number, size);
+  } else if (size >= kToom4Threshold) {
+    MultiplyToom4(result, number, size, number, size);
+  } else if (size >= kToom3Threshold) {
+    MultiplyToom3(result, number, size, number, size);
+  } else {
+    SquareKaratsuba(result, number, size);
+  }
+}
+
+/**
+ * @brief Cuadrado clásico (schoolbook). Por simetría, cada producto cruzado x[i] * x[j] con i < j se
+ * calcula una sola vez; la suma se duplica y se añaden los cuadrados de la diagonal
+ *
+ * @tparam Base
+ * @param result
+ * @param number
+ * @param size
+ */
+template <size_t Base>
+void Limbs<Base>::SquareBasecase(Limb *result, const Limb *number, size_t size) {
+  std::fill(result, result + 2 * size, 0);
+  for (size_t i = 0; i + 1 < size; i++) {
+    Limb carry = 0;
+    for (size_t j = i + 1; j < size; j++) {
+      DoubleLimb tmp = static_cast<DoubleLimb>(number[i]) * number[j] + result[i + j] + carry;
+      carry = SplitRadix(tmp, result[i + j]);
+    }
+    result[i + size] = carry;
+  }
+  AddTo(result, 2 * size, result, 2 * size);  // 2 * sum(x[i] * x[j]) < R^(2 * size): no hay acarreo final
+  for (size_t i = 0; i < size; i++) {
+    Limb diagonal[2];
+    diagonal[1] = SplitRadix(static_cast<DoubleLimb>(number[i]) * number[i], diagonal[0]);
+    AddTo(result + 2 * i, 2 * (size - i), diagonal, 2);
+  }
+}
+
+/**
+ * @brief Cuadrado con Karatsuba: con x = x1 * R^half + x0 bastan 3 cuadrados, x0^2, x1^2 y (x0 + x1)^2,
+ * del que se restan los 2 anteriores para obtener el término central 2 * x0 * x1
+ *
+ * @tparam Base
+ * @param result
+ * @param number
+ * @param size
+ */
+template <size_t Base>
+void Limbs<Base>::SquareKaratsuba(Limb *result, const Limb *number, size_t size) {
+  size_t half = (size + 1) / 2;
+  size_t size_1 = size - half;
+
+  // z0 = x0^2 en la parte baja y z2 = x1^2 en la parte alta del resultado
+  Square(result, number, half);
+  Square(result + 2 * half, number + half, size_1);
+
+  // z1 = (x0 + x1)^2 - z0 - z2
+  Vector sum(number, number + half);
+  sum.push_back(AddTo(sum.data(), half, number + half, size_1));
+  Vector middle(2 * half + 2);
+  Square(middle.data(), sum.data(), half + 1);
+  SubtractFrom(middle.data(), middle.size(), result, 2 * half);
+  SubtractFrom(middle.data(), middle.size(), result + 2 * half, 2 * size_1);
+
+  size_t size_middle = std::min(middle.size(), 2 * size - half);
+  AddTo(result + half, 2 * size - half, middle.data(), size_middle);
+}
+
+/**
+ * @brief Multiplica 2 magnitudes con el algoritmo clásico (schoolbook), limb a limb
+ *
+ * @tparam Base
+ * @param result
+ * @param number_x
+ * @param size_x
+ * @param number_y
+ * @param size_y
+ */
+template <size_t Base>
+void Limbs<Base>::MultiplyBasecase(Limb *result, const Limb *number_x, size_t size_x, const Limb *number_y,
+                                   size_t size_y) {
+  std::fill(result, result + size_x + size_y, 0);
+  for (size_t i = 0; i < size_x; i++) {
+    if constexpr ((kRadix & (kRadix - 1)) == 0) {
+      Limb carry = 0;
+      for (size_t j = 0; j < size_y; j++) {
+        DoubleLimb tmp = static_cast<DoubleLimb>(number_x[i]) * number_y[j] + result[i + j] + carry;
+        carry = SplitRadix(tmp, result[i + j]);
+      }
+      result[i + size_y] = carry;
+    } else {
+      // la parte alta de cada producto se suma en la siguiente posición, de forma que la cadena de
+      // dependencias entre iteraciones es un acarreo de 0 o 1 y no la división entre el radix
+      Limb high = 0;
+      Limb carry = 0;
+      for (size_t j = 0; j < size_y; j++) {
+        Limb low;
+        Limb next_high = SplitRadix(static_cast<DoubleLimb>(number_x[i]) * number_y[j] + result[i + j], low);
+        DoubleLimb sum = static_cast<DoubleLimb>(low) + high + carry;
+        carry = sum >= kRadix ? 1 : 0;
+        result[i + j] = static_cast<Limb>(sum - (kRadix & -static_cast<DoubleLimb>(carry)));
+        high = next_high;
+      }
+      result[i + size_y] = high + carry;
+    }
+  }
+}
+
+/**
+ * @brief Multiplica 2 magnitudes con el algoritmo de Karatsuba. Se parte cada operando en 2 mitades de
+ * half limbs (x = x1 * R^half + x0) y se calculan solo 3 productos: x0 * y0, x1 * y1 y
+ * (x0 + x1) * (y0 + y1), del que se restan los 2 anteriores para obtener el término central.
+ * Requiere size_x >= size_y > (size_x + 1) / 2
+ *
+ * @tparam Base
+ * @param result
+ * @param number_x
+ * @param size_x
+ * @param number_y
+ * @param size_y
+ */
+template <size_t Base>
+void Limbs<Base>::MultiplyKaratsuba(Limb *result, const Limb *number_x, size_t size_x, const Limb *number_y,
+                                    size_t size_y) {
+  size_t half = (size_x + 1) / 2;
+  size_t size_x1 = size_x - half;
+  size_t size_y1 = size_y - half;
+
+  // z0 = x0 * y0 en la parte baja y z2 = x1 * y1 en la parte alta del resultado
+  Multiply(result, number_x, half, number_y, half);
+  Multiply(result + 2 * half, number_x + half, size_x1, number_y + half, size_y1);
+
+  // z1 = (x0 + x1) * (y0 + y1) - z0 - z2
+  Vector sum_x(number_x, number_x + half);
+  Vector sum_y(number_y, number_y + half);
+  sum_x.push_back(AddTo(sum_x.data(), half, number_x + half, size_x1));
+  sum_y.push_back(AddTo(sum_y.data(), half, number_y + half, size_y1));
+  Vector middle(2 * half + 2);
+  Multiply(middle.data(), sum_x.data(), half + 1, sum_y.data(), half + 1);
+  SubtractFrom(middle.data(), middle.size(), result, 2 * half);
+  SubtractFrom(middle.data(), middle.size(), result + 2 * half, size_x1 + size_y1);
+
+  // se suma z1 desplazado half limbs (z1 < R^(size_x + size_y - half), los limbs superiores son 0)
+  size_t size_middle = std::min(middle.size(), size_x + size_y - half);
+  AddTo(result + half, size_x + size_y - half, middle.data(), size_middle);
+}
+
+/**
+ * @brief Multiplica 2 magnitudes con Toom-3. Cada operando se parte en 3 trozos de part limbs (un
+ * polinomio de grado 2 en R^part), se evalúan en 0, 1, -1, 2 e infinito, se multiplican los 5 pares
+ * de valores y se interpola el producto (grado 4) con divisiones exactas entre 2 y 3.
+ * Requiere size_x >= size_y > (size_x + 1) / 2
+ *
+ * @tparam Base
+ * @param result
+ * @param number_x
+ * @param size_x
+ * @param number_y
+ * @param size_y
+ */
+template <size_t Base>
+void Limbs<Base>::MultiplyToom3(Limb *result, const Limb *number_x, size_t size_x, const Limb *number_y,
+                                size_t size_y) {
+  size_t part = (size_x + 2) / 3;
+  bool square = number_x == number_y && size_x == size_y;  // en un cuadrado se evalúa un solo operando
+  std::vector<Vector> parts_x = Split(number_x, size_x, part, 3);
+  std::vector<Vector> parts_y = square ? std::vector<Vector>() : Split(number_y, size_y, part, 3);
+
+  // productos en los puntos 0, 1, -1, 2 e infinito
+  Signed r0 = ProductAt(parts_x, parts_y, 0, square);
+  Signed r1 = ProductAt(parts_x, parts_y, 1, square);
+  Signed rm1 = ProductAt(parts_x, parts_y, -1, square);
+  Signed r2 = ProductAt(parts_x, parts_y, 2, square);
+  Signed rinf;
+  rinf.magnitude = square ? Square(parts_x[2]) : Multiply(parts_x[2], parts_y[2]);
+
+  // interpolación: c0 = r(0), c4 = r(inf)
+  // c2 = (r(1) + r(-1)) / 2 - c0 - c4
+  Signed c2 = r1;
+  AddSigned(c2, rm1, false);
+  DivideExact(c2, 2);
+  AddSigned(c2, r0, true);
+  AddSigned(c2, rinf, true);
+  // c1 + c3 = (r(1) - r(-1)) / 2
+  Signed odd = r1;
+  AddSigned(odd, rm1, true);
+  DivideExact(odd, 2);
+  // c1 + 4 * c3 = (r(2) - c0 - 4 * c2 - 16 * c4) / 2
+  Signed c3 = r2;
+  AddSigned(c3, r0, true);
+  Signed term = c2;
+  ScaleSigned(term, 4);
+  AddSigned(c3, term, true);
+  term = rinf;
+  ScaleSigned(term, 16);
+  AddSigned(c3, term, true);
+  DivideExact(c3, 2);
+  // c3 = ((c1 + 4 * c3) - (c1 + c3)) / 3, c1 = (c1 + c3) - c3
+  AddSigned(c3, odd, true);
+  DivideExact(c3, 3);
+  Signed c1 = odd;
+  AddSigned(c1, c3, true);
+
+  Recompose(result, size_x + size_y, {r0, c1, c2, c3, rinf}, part);
+}
+
+/**
+ * @brief Multiplica 2 magnitudes con Toom-4. Cada operando se parte en 4 trozos de part limbs, se
+ * evalúan en 0, 1, -1, 2, -2, 3 e infinito y se interpola el producto (grado 6) separando los
+ * coeficientes pares e impares, con divisiones exactas entre 2, 3, 4, 5 y 8.
+ * Requiere size_x >= size_y > (size_x + 1) / 2
+ *
+ * @tparam Base
+ * @param result
+ * @param number_x
+ * @param size_x
+ * @param number_y
+ * @param size_y
+ */
+template <size_t Base>
+void Limbs<Base>::MultiplyToom4(Limb *result, const Limb *number_x, size_t size_x, const Limb *number_y,
+                                size_t size_y) {
+  size_t part = (size_x + 3) / 4;
+  bool square = number_x == number_y && size_x == size_y;  // en un cuadrado se evalúa un solo operando
+  std::vector<Vector> parts_x = Split(number_x, size_x, part, 4);
+  std::vector<Vector> parts_y = square ? std::vector<Vector>() : Split(number_y, size_y, part, 4);
+
+  // productos en los puntos 0, 1, -1, 2, -2, 3 e infinito
+  Signed r0 = ProductAt(parts_x, parts_y, 0, square);
+  Signed r1 = ProductAt(parts_x, parts_y, 1, square);
+  Signed rm1 = ProductAt(parts_x, parts_y, -1, square);
+  Signed r2 = ProductAt(parts_x, parts_y, 2, square);
+  Signed rm2 = ProductAt(parts_x, parts_y, -2, square);
+  Signed r3 = ProductAt(parts_x, parts_y, 3, square);
+  Signed rinf;
+  rinf.magnitude = square ? Square(parts_x[3]) : Multiply(parts_x[3], parts_y[3]);
+  Signed term;
+
+  // coeficientes pares: c2 + c4 = (r(1) + r(-1)) / 2 - c0 - c6
+  Signed even1 = r1;
+  AddSigned(even1, rm1, false);
+  DivideExact(even1, 2);
+  AddSigned(even1, r0, true);
+  AddSigned(even1, rinf, true);
+  // c2 + 4 * c4 = ((r(2) + r(-2)) / 2 - c0 - 64 * c6) / 4
+  Signed even2 = r2;
+  AddSigned(even2, rm2, false);
+  DivideExact(even2, 2);
+  AddSigned(even2, r0, true);
+  term = rinf;
+  ScaleSigned(term, 64);
+  AddSigned(even2, term, true);
+  DivideExact(even2, 4);
+  Signed c4 = even2;
+  AddSigned(c4, even1, true);
+  DivideExact(c4, 3);
+  Signed c2 = even1;
+  AddSigned(c2, c4, true);
+
+  // coeficientes impares: c1 + c3 + c5 = (r(1) - r(-1)) / 2
+  Signed odd1 = r1;
+  AddSigned(odd1, rm1, true);
+  DivideExact(odd1, 2);
+  // c1 + 4 * c3 + 16 * c5 = (r(2) - r(-2)) / 4
+  Signed odd2 = r2;
+  AddSigned(odd2, rm2, true);
+  DivideExact(odd2, 4);
+  // c1 + 9 * c3 + 81 * c5 = (r(3) - c0 - 9 * c2 - 81 * c4 - 729 * c6) / 3
+  Signed odd3 = r3;
+  AddSigned(odd3, r0, true);
+  term = c2;
+  ScaleSigned(term, 9);
+  AddSigned(odd3, term, true);
+  term = c4;
+  ScaleSigned(term, 81);
+  AddSigned(odd3, term, true);
+  term = rinf;
+  ScaleSigned(term, 729);
+  AddSigned(odd3, term, true);
+  DivideExact(odd3, 3);
+  // c3 + 5 * c5 = (odd2 - odd1) / 3, c3 + 13 * c5 = (odd3 - odd2) / 5
+  Signed difference1 = odd2;
+  AddSigned(difference1, odd1, true);
+  DivideExact(difference1, 3);
+  Signed difference2 = odd3;
+  AddSigned(difference2, odd2, true);
+  DivideExact(difference2, 5);
+  Signed c5 = difference2;
+  AddSigned(c5, difference1, true);
+  DivideExact(c5, 8);
+  Signed c3 = difference1;
+  term = c5;
+  ScaleSigned(term, 5);
+  AddSigned(c3, term, true);
+  Signed c1 = odd1;
+  AddSigned(c1, c3, true);
+  AddSigned(c1, c5, true);
+
+  Recompose(result, size_x + size_y, {r0, c1, c2, c3, c4, c5, rinf}, part);
+}
+
+/**
+ * @brief Parte una magnitud en pieces trozos de part limbs (el último puede ser más corto o vacío)
+ *
+ * @tparam Base
+ * @param number
+ * @param size
+ * @param part
+ * @param pieces
+ * @return std::vector<Vector>
+ */
+template <size_t Base>
+std::vector<typename Limbs<Base>::Vector> Limbs<Base>::Split(const Limb *number, size_t size, size_t part,
+                                                              size_t pieces) {
+  std::vector<Vector> parts(pieces);
+  for (size_t i = 0; i < pieces; i++) {
+    size_t begin = std::min(size, i * part);
+    size_t end = std::min(size, begin + part);
+    parts[i].assign(number + begin, number + end);
+    Trim(parts[i]);
+  }
+  return parts;
+}
+
+/**
+ * @brief Evalúa el polinomio cuyos coeficientes son los trozos en un punto pequeño (regla de Horner)
+ *
+ * @tparam Base
+ * @param parts
+ * @param point
+ * @return Signed
+ */
+template <size_t Base>
+typename Limbs<Base>::Signed Limbs<Base>::Evaluate(const std::vector<Vector> &parts, long point) {
+  Signed value;
+  if (point == 0) {
+    value.magnitude = parts[0];
+    return value;
+  }
+  Signed coefficient;
+  for (size_t i = parts.size(); i > 0; i--) {
+    ScaleSigned(value, point < 0 ? -point : point);
+    if (point < 0 && !value.magnitude.empty()) {
+      value.negative = !value.negative;
+    }
+    coefficient.magnitude = parts[i - 1];
+    AddSigned(value, coefficient, false);
+  }
+  return value;
+}
+
+/**
+ * @brief Multiplica 2 enteros con signo usando el selector de multiplicación
+ *
+ * @tparam Base
+ * @param number_x
+ * @param number_y
+ * @return Signed
+ */
+template <size_t Base>
+typename Limbs<Base>::Signed Limbs<Base>::MultiplySigned(const Signed &number_x, const Signed &number_y) {
+  Signed product;
+  product.magnitude = Multiply(number_x.magnitude, number_y.magnitude);
+  product.negative = !product.magnitude.empty() && number_x.negative != number_y.negative;
+  return product;
+}
+
+/**
+ * @brief Producto de los 2 operandos evaluados en un punto. En un cuadrado solo se evalúa parts_x y el
+ * valor se eleva al cuadrado
+ *
+ * @tparam Base
+ * @param parts_x
+ * @param parts_y
+ * @param point
+ * @param square
+ * @return Signed
+ */
+template <size_t Base>
+typename Limbs<Base>::Signed Limbs<Base>::ProductAt(const std::vector<Vector> &parts_x,
+                                                    const std::vector<Vector> &parts_y, long point, bool square) {
+  Signed value_x = Evaluate(parts_x, point);
+  if (square) {
+    Signed product;
+    product.magnitude = Square(value_x.magnitude);
+    return product;
+  }
+  return MultiplySigned(value_x, Evaluate(parts_y, point));
+}
+
+/**
+ * @brief Suma (o resta si subtract es true) un entero con signo a otro: number_x = number_x +- number_y
+ *
+ * @tparam Base
+ * @param number_x
+ * @param number_y
+ * @param subtract
+ */
+template <size_t Base>
+void Limbs<Base>::AddSigned(Signed &number_x, const Signed &number_y, bool subtract) {
+  Accumulate(number_x.magnitude, number_x.negative, number_y.magnitude, number_y.negative != subtract);
+}
+
+/**
+ * @brief Suma en el lugar 2 magnitudes con signo: (magnitude, negative) += (other, negative_other). Se
+ * reutiliza el vector de magnitude, que solo crece si hace falta. Admite que other sea el propio magnitude
+ *
+ * @tparam Base
+ * @param magnitude
+ * @param negative
+ * @param other
+ * @param negative_other
+ */
+template <size_t Base>
+void Limbs<Base>::Accumulate(Vector &magnitude, bool &negative, const Vector &other, bool negative_other) {
+  if (negative == negative_other) {
+    if (magnitude.size() < other.size()) {
+      magnitude.resize(other.size(), 0);
+    }
+    Limb carry = AddTo(magnitude.data(), magnitude.size(), other.data(), other.size());
+    if (carry != 0) {
+      magnitude.push_back(carry);
+    }
+  } else if (Compare(magnitude, other) >= 0) {
+    SubtractFrom(magnitude.data(), magnitude.size(), other.data(), other.size());
+  } else {
+    // |other| > |magnitude|: se calcula other - magnitude sobre el propio vector
+    magnitude.resize(other.size(), 0);
+    Limb borrow = 0;
+    for (size_t i = 0; i < other.size(); i++) {
+      DoubleLimb subtrahend = static_cast<DoubleLimb>(magnitude[i]) + borrow;
+      borrow = other[i] < subtrahend ? 1 : 0;
+      magnitude[i] = static_cast<Limb>(other[i] + (kRadix & -static_cast<DoubleLimb>(borrow)) - subtrahend);
+    }
+    negative = negative_other;
+  }
+  Trim(magnitude);
+  if (magnitude.empty()) {
+    negative = false;
+  }
+}
+
+/**
+ * @brief Suma 1 a la magnitud en el lugar. Se detiene en el primer limb que no produce acarreo
+ *
+ * @tparam Base
+ * @param number
+ */
+template <size_t Base>
+void Limbs<Base>::Increment(Vector &number) {
+  for (size_t i = 0; i < number.size(); i++) {
+    if (number[i] != static_cast<Limb>(kRadix - 1)) {
+      number[i]++;
+      return;
+    }
+    number[i] = 0;
+  }
+  number.push_back(1);
+}
+
+/**
+ * @brief Resta 1 a una magnitud no nula en el lugar. Se detiene en el primer limb que no pide préstamo
+ *
+ * @tparam Base
+ * @param number
+ */
+template <size_t Base>
+void Limbs<Base>::Decrement(Vector &number) {
+  for (size_t i = 0; i < number.size(); i++) {
+    if (number[i] != 0) {
+      number[i]--;
+      break;
+    }
+    number[i] = static_cast<Limb>(kRadix - 1);
+  }
+  Trim(number);
+}
+
+/**
+ * @brief Multiplica un entero con signo por un limb
+ *
+ * @tparam Base
+ * @param number
+ * @param factor
+ */
+template <size_t Base>
+void Limbs<Base>::ScaleSigned(Signed &number, Limb factor) {
+  MultiplySmall(number.magnitude, factor, 0);
+}
+
+/**
+ * @brief Divide un entero con signo entre un limb sabiendo que la división es exacta
+ *
+ * @tparam Base
+ * @param number
+ * @param divisor
+ */
+template <size_t Base>
+void Limbs<Base>::DivideExact(Signed &number, Limb divisor) {
+  DivideSmall(number.magnitude, divisor);
+}
+
+/**
+ * @brief Recompone el producto a partir de los coeficientes interpolados (todos no negativos):
+ * result = sum(coefficients[i] * R^(i * part))
+ *
+ * @tparam Base
+ * @param result
+ * @param size_result
+ * @param coefficients
+ * @param part
+ */
+template <size_t Base>
+void Limbs<Base>::Recompose(Limb *result, size_t size_result, const std::vector<Signed> &coefficients,
+                            size_t part) {
+  std::fill(result, result + size_result, 0);
+  for (size_t i = 0; i < coefficients.size(); i++) {
+    const Vector &coefficient = coefficients[i].magnitude;
+    if (!coefficient.empty()) {
+      AddTo(result + i * part, size_result - i * part, coefficient.data(), coefficient.size());
+    }
+  }
+}
+
+/**
+ * @brief Suma en el lugar: result += number. Devuelve el acarreo que sale de result
+ *
+ * @tparam Base
+ * @param result
+ * @param size_result
+ * @param number
+ * @param size_number
+ * @return Limb
+ */
+template <size_t Base>
+typename Limbs<Base>::Limb Limbs<Base>::AddTo(Limb *result, size_t size_result, const Limb *number,
+                                              size_t size_number) {
+  Limb carry = 0;
+  size_t i = 0;
+  if constexpr (kRadixBits == 64) {  // radix 2^64: el acarreo sale del flag de la suma (adc)
+    for (; i < size_number; i++) {
+      Limb sum;
+      bool overflow = __builtin_add_overflow(result[i], number[i], &sum);
+      overflow |= __builtin_add_overflow(sum, carry, &result[i]);
+      carry = overflow;
+    }
+    for (; carry != 0 && i < size_result; i++) {
+      carry = ++result[i] == 0;
+    }
+    return carry;
+  }
+  for (; i < size_number; i++) {
+    DoubleLimb sum = static_cast<DoubleLimb>(result[i]) + number[i] + carry;
+    carry = sum >= kRadix ? 1 : 0;
+    result[i] = static_cast<Limb>(sum - (kRadix & -static_cast<DoubleLimb>(carry)));
+  }
+  for (; carry != 0 && i < size_result; i++) {
+    DoubleLimb sum = static_cast<DoubleLimb>(result[i]) + carry;
+    carry = sum >= kRadix ? 1 : 0;
+    result[i] = static_cast<Limb>(carry ? sum - kRadix : sum);
+  }
+  return carry;
+}
+
+/**
+ * @brief Resta en el lugar: result -= number. Devuelve el préstamo que sale de result
+ *
+ * @tparam Base
+ * @param result
+ * @param size_result
+ * @param number
+ * @param size_number
+ * @return Limb
+ */
+template <size_t Base>
+typename Limbs<Base>::Limb Limbs<Base>::SubtractFrom(Limb *result, size_t size_result, const Limb *number,
+                                                     size_t size_number) {
+  Limb borrow = 0;
+  size_t i = 0;
+  if constexpr (kRadixBits == 64) {  // radix 2^64: el préstamo sale del flag de la resta (sbb)
+    for (; i < size_number; i++) {
+      Limb difference;
+      bool overflow = __builtin_sub_overflow(result[i], number[i], &difference);
+      overflow |= __builtin_sub_overflow(difference, borrow, &result[i]);
+      borrow = overflow;
+    }
+    for (; borrow != 0 && i < size_result; i++) {
+      borrow = result[i]-- == 0;
+    }
+    return borrow;
+  }
+  for (; i < size_number; i++) {
+    DoubleLimb subtrahend = static_cast<DoubleLimb>(number[i]) + borrow;
+    borrow = result[i] < subtrahend ? 1 : 0;
+    result[i] = static_cast<Limb>(result[i] + (kRadix & -static_cast<DoubleLimb>(borrow)) - subtrahend);
+  }
+  for (; borrow != 0 && i < size_result; i++) {
+    borrow = result[i] == 0 ? 1 : 0;
+    result[i] = static_cast<Limb>(borrow ? kRadix - 1 : result[i] - 1);
+  }
+  return borrow;
+}
+
+/**
+ * @brief Multiplica la magnitud por un limb y le suma otro (number = number * factor + addend)
+ *
+ * @tparam Base
+ * @param number
+ * @param factor
+ * @param addend
+ */
+template <size_t Base>
+void Limbs<Base>::MultiplySmall(Vector &number, Limb factor, Limb addend) {
+  Limb carry = addend;
+  for (size_t i = 0; i < number.size(); i++) {
+    DoubleLimb tmp = static_cast<DoubleLimb>(number[i]) * factor + carry;
+    carry = SplitRadix(tmp, number[i]);
+  }
+  if (carry != 0) {
+    number.push_back(carry);
+  }
+  Trim(number);
+}
+
+/**
+ * @brief Desplaza la magnitud n dígitos a la izquierda en el lugar (multiplica por Base^n). Los limbs
+ * completos se insertan como ceros de una vez; el resto de dígitos se aplica con un desplazamiento de bits
+ * entre limbs vecinos si el radix es potencia de 2 o con un producto por un limb si no lo es
+ *
+ * @tparam Base
+ * @param number
+ * @param n
+ */
+template <size_t Base>
+void Limbs<Base>::ShiftLeft(Vector &number, size_t n) {
+  if (IsZero(number)) {
+    return;
+  }
+  size_t digits = n % kDigits;
+  if (digits != 0) {
+    if constexpr (kRadixBits != 0) {
+      unsigned bits = digits * (kRadixBits / kDigits);
+      Limb carry = 0;
+      for (size_t i = 0; i < number.size(); i++) {
+        Limb value = number[i];
+        number[i] = ((value << bits) | carry) & static_cast<Limb>(kRadix - 1);
+        carry = value >> (kRadixBits - bits);
+      }
+      if (carry != 0) {
+        number.push_back(carry);
+      }
+    } else {
+      MultiplySmall(number, Power(digits), 0);
+    }
+  }
+  number.insert(number.begin(), n / kDigits, 0);
+}
+
+/**
+ * @brief Desplaza la magnitud n dígitos a la derecha en el lugar (divide por Base^n truncando). Los limbs
+ * completos se descartan de una vez y el resto de dígitos se aplica como en ShiftLeft
+ *
+ * @tparam Base
+ * @param number
+ * @param n
+ */
+template <size_t Base>
+void Limbs<Base>::ShiftRight(Vector &number, size_t n) {
+  size_t limbs = n / kDigits;
+  if (limbs >= number.size()) {
+    number.clear();
+    return;
+  }
+  number.erase(number.begin(), number.begin() + limbs);
+  size_t digits = n % kDigits;
+  if (digits != 0) {
+    if constexpr (kRadixBits != 0) {
+      unsigned bits = digits * (kRadixBits / kDigits);
+      for (size_t i = 0; i < number.size(); i++) {
+        Limb high = i + 1 < number.size() ? number[i + 1] : 0;
+        number[i] = ((number[i] >> bits) | (high << (kRadixBits - bits))) & static_cast<Limb>(kRadix - 1);
+      }
+    } else {
+      DivideSmall(number, Power(digits));
+    }
+  }
+  Trim(number);
+}
+
+/**
+ * @brief Divide la magnitud entre un limb no nulo y devuelve el resto de la división
+ *
+ * @tparam Base
+ * @param number
+ * @param divisor
+ * @return Limb
+ */
+template <size_t Base>
+typename Limbs<Base>::Limb Limbs<Base>::DivideSmall(Vector &number, Limb divisor) {
+  // se normaliza el divisor una sola vez para dividir cada limb multiplicando por su recíproco
+  int shift = __builtin_clzll(divisor);
+  Limb divisor_normalized = divisor << shift;
+  Limb inverse = Reciprocal(divisor_normalized);
+  Limb remainder = 0;
+  for (size_t i = number.size(); i > 0; i--) {
+    DoubleLimb value = static_cast<DoubleLimb>(remainder) * kRadix + number[i - 1];
+    number[i - 1] = DivideNormalized(value, divisor_normalized, inverse, shift, remainder);
+  }
+  Trim(number);
+  return remainder;
+}
+
+/**
+ * @brief Divide 2 magnitudes y deja en quotient y remainder el cociente y el resto. Si el divisor y el
+ * cociente superan kBurnikelThreshold limbs se usa la división recursiva de Burnikel-Ziegler, que se apoya
+ * en la multiplicación rápida; si no, la división larga de Knuth. El divisor no puede ser cero
+ *
+ * @tparam Base
+ * @param number_x
+ * @param number_y
+ * @param quotient
+ * @param remainder
+ */
+template <size_t Base>
+void Limbs<Base>::Divide(const Vector &number_x, const Vector &number_y, Vector &quotient, Vector &remainder) {
+  if (number_y.size() < kBurnikelThreshold || number_x.size() < number_y.size() + kBurnikelThreshold) {
+    DivideBasecase(number_x, number_y, quotient, remainder);
+    return;
+  }
+  // normalización del divisor, igual que en la división larga
+  const size_t size_y = number_y.size();
+  const Limb factor = static_cast<Limb>(kRadix / (static_cast<DoubleLimb>(number_y.back()) + 1));
+  Vector divisor = number_y;
+  Vector dividend = number_x;
+  MultiplySmall(divisor, factor, 0);
+  MultiplySmall(dividend, factor, 0);
+
+  // el dividendo se recorre en bloques de size_y limbs, como una división larga en radix R^size_y:
+  // cada paso divide (resto * R^size_y + bloque), que es menor que divisor * R^size_y
+  const size_t blocks = (dividend.size() + size_y - 1) / size_y;
+  quotient.assign(blocks * size_y + 1, 0);
+  Vector rest;
+  for (size_t i = blocks; i > 0; i--) {
+    Vector current = Slice(dividend, (i - 1) * size_y, i * size_y);
+    if (!rest.empty()) {
+      current.resize(size_y, 0);
+      current.insert(current.end(), rest.begin(), rest.end());
+    }
+    Vector partial;
+    DivideRecursive(current, divisor, partial, rest);
+    if (!partial.empty()) {
+      AddTo(quotient.data() + (i - 1) * size_y, quotient.size() - (i - 1) * size_y, partial.data(), partial.size());
+    }
+  }
+  Trim(quotient);
+  DivideSmall(rest, factor);
+  remainder = rest;
+}
+
+/**
+ * @brief Resto de la división de 2 magnitudes. Si el divisor ya se ha usado hace poco (un mismo módulo para
+ * muchos valores), se reduce con su reductor de Barrett en caché: 2 multiplicaciones por cada n limbs del
+ * dividendo en lugar de una división. La primera vez que aparece un divisor, o si supera kBarrettMaxSize
+ * limbs, se divide normalmente
+ *
+ * @tparam Base
+ * @param number
+ * @param modulus
+ * @return Vector
+ */
+template <size_t Base>
+typename Limbs<Base>::Vector Limbs<Base>::Remainder(const Vector &number, const Vector &modulus) {
+  if (modulus.size() >= kBarrettThreshold && modulus.size() <= kBarrettMaxSize && number.size() >= modulus.size()) {
+    const Barrett *reducer = CachedBarrett(modulus);
+    if (reducer != nullptr) {
+      return Reduce(number, *reducer);
+    }
+  }
+  Vector quotient, remainder;
+  Divide(number, modulus, quotient, remainder);
+  return remainder;
+}
+
+/**
+ * @brief Prepara un módulo (sin ceros por la izquierda) para la reducción de Barrett: floor(R^(2n) / m)
+ *
+ * @tparam Base
+ * @param modulus
+ * @return Barrett
+ */
+template <size_t Base>
+typename Limbs<Base>::Barrett Limbs<Base>::MakeBarrett(const Vector &modulus) {
+  Barrett reducer;
+  reducer.modulus = modulus;
+  Vector power(2 * modulus.size() + 1, 0), remainder;
+  power.back() = 1;
+  Divide(power, modulus, reducer.reciprocal, remainder);
+  return reducer;
+}
+
+/**
+ * @brief Reducción de Barrett: number mod m. Para number < R^(2n) el cociente se estima como
+ * floor(floor(number / R^(n-1)) * reciprocal / R^(n+1)), que se queda corto como mucho en 2, y el resto se
+ * corrige con restas. Los dividendos mayores se reducen por bloques de n limbs desde los más significativos,
+ * como una división larga en radix R^n
+ *
+ * @tparam Base
+ * @param number
+ * @param reducer
+ * @return Vector
+ */
+template <size_t Base>
+typename Limbs<Base>::Vector Limbs<Base>::Reduce(const Vector &number, const Barrett &reducer) {
+  const size_t size = reducer.modulus.size();
+  if (number.size() > 2 * size) {
+    const size_t blocks = (number.size() + size - 1) / size;
+    Vector remainder;
+    for (size_t i = blocks; i > 0; i--) {
+      Vector current = Slice(number, (i - 1) * size, i * size);
+      if (!remainder.empty()) {
+        current.resize(size, 0);
+        current.insert(current.end(), remainder.begin(), remainder.end());
+      }
+      remainder = Reduce(current, reducer);
+    }
+    return remainder;
+  }
+  Vector estimate = Multiply(Slice(number, size - 1, number.size()), reducer.reciprocal);
+  estimate = Slice(estimate, size + 1, estimate.size());
+  Vector remainder = Subtract(number, Multiply(estimate, reducer.modulus));
+  while (Compare(remainder, reducer.modulus) >= 0) {
+    remainder = Subtract(remainder, reducer.modulus);
+  }
+  return remainder;
+}
+
+/**
+ * @brief Busca un módulo en la caché de reductores (los kReducerCacheSize más recientes, el último al
+ * principio). Un módulo nuevo se apunta sin recíproco y devuelve nullptr; si ya estaba, se le calcula el
+ * recíproco si aún no lo tenía. Cada hilo tiene su propia caché, así que el puntero devuelto solo lo
+ * invalida la siguiente llamada desde el mismo hilo: hay que usarlo antes de volver a llamar a Remainder
+ *
+ * @tparam Base
+ * @param modulus
+ * @return const Barrett*
+ */
+template <size_t Base>
+const typename Limbs<Base>::Barrett *Limbs<Base>::CachedBarrett(const Vector &modulus) {
+  thread_local std::vector<Barrett> cache;
+  size_t i = 0;
+  while (i < cache.size() && cache[i].modulus != modulus) {
+    i++;
+  }
+  if (i == cache.size()) {
+    if (cache.size() == kReducerCacheSize) {
+      cache.pop_back();
+    }
+    cache.insert(cache.begin(), Barrett{modulus, Vector()});
+    return nullptr;
+  }
+  std::rotate(cache.begin(), cache.begin() + i, cache.begin() + i + 1);
+  if (cache[0].reciprocal.empty()) {
+    cache[0] = MakeBarrett(modulus);
+  }
+  return &cache[0];
+}
+
+/**
+ * @brief División recursiva de Burnikel-Ziegler (RecursiveDivRem, Brent y Zimmermann). El divisor debe
+ * estar normalizado (limb superior >= R / 2). Con k la mitad de los limbs del cociente, el dividendo sin
+ * sus 2k limbs inferiores se divide recursivamente entre el divisor sin sus k limbs inferiores; la
+ * estimación del cociente se pasa como mucho en 2 y se corrige sumando el divisor. Se repite con la
+ * mitad inferior, de forma que el coste es el de O(log n) multiplicaciones de tamaño n
+ *
+ * @tparam Base
+ * @param number_x
+ * @param number_y
+ * @param quotient
+ * @param remainder
+ */
+template <size_t Base>
+void Limbs<Base>::DivideRecursive(const Vector &number_x, const Vector &number_y, Vector &quotient,
+                                  Vector &remainder) {
+  const size_t size_y = number_y.size();
+  const size_t size_quotient = number_x.size() > size_y ? number_x.size() - size_y : 0;
+  if (size_quotient < kBurnikelThreshold) {
+    DivideBasecase(number_x, number_y, quotient, remainder);
+    return;
+  }
+  const size_t k = size_quotient / 2;
+  const Vector divisor_high = Slice(number_y, k, size_y);
+  const Vector divisor_low = Slice(number_y, 0, k);
+  Signed divisor_shifted;
+  divisor_shifted.magnitude = number_y;
+  divisor_shifted.magnitude.insert(divisor_shifted.magnitude.begin(), k, 0);
+  Signed divisor;
+  divisor.magnitude = number_y;
+  const Vector one(1, 1);
+
+  // mitad superior: Q1 = (X div R^2k) div Y1, X' = X - Q1 * Y * R^k
+  Vector quotient_high, remainder_high;
+  DivideRecursive(Slice(number_x, 2 * k, number_x.size()), divisor_high, quotient_high, remainder_high);
+  Signed rest;
+  rest.magnitude = Slice(number_x, 0, 2 * k);
+  rest.magnitude.resize(2 * k, 0);
+  rest.magnitude.insert(rest.magnitude.end(), remainder_high.begin(), remainder_high.end());
+  Trim(rest.magnitude);
+  Signed correction;
+  correction.magnitude = Multiply(quotient_high, divisor_low);
+  if (!correction.magnitude.empty()) {
+    correction.magnitude.insert(correction.magnitude.begin(), k, 0);
+  }
+  AddSigned(rest, correction, true);
+  while (rest.negative) {
+    quotient_high = Subtract(quotient_high, one);
+    AddSigned(rest, divisor_shifted, false);
+  }
+
+  // mitad inferior: Q0 = (X' div R^k) div Y1, X'' = X' - Q0 * Y
+  Vector quotient_low, remainder_low;
+  DivideRecursive(Slice(rest.magnitude, k, rest.magnitude.size()), divisor_high, quotient_low, remainder_low);
+  Signed rest_low;
+  rest_low.magnitude = Slice(rest.magnitude, 0, k);
+  rest_low.magnitude.resize(k, 0);
+  rest_low.magnitude.insert(rest_low.magnitude.end(), remainder_low.begin(), remainder_low.end());
+  Trim(rest_low.magnitude);
+  correction.magnitude = Multiply(quotient_low, divisor_low);
+  AddSigned(rest_low, correction, true);
+  while (rest_low.negative) {
+    quotient_low = Subtract(quotient_low, one);
+    AddSigned(rest_low, divisor, false);
+  }
+
+  // Q = Q1 * R^k + Q0, con Q0 < R^k
+  quotient = quotient_low;
+  quotient.resize(k, 0);
+  quotient.insert(quotient.end(), quotient_high.begin(), quotient_high.end());
+  Trim(quotient);
+  remainder = rest_low.magnitude;
+}
+
+/**
+ * @brief Devuelve los limbs [begin, end) de una magnitud (acotados a su tamaño), sin ceros superiores
+ *
+ * @tparam Base
+ * @param number
+ * @param begin
+ * @param end
+ * @return Vector
+ */
+template <size_t Base>
+typename Limbs<Base>::Vector Limbs<Base>::Slice(const Vector &number, size_t begin, size_t end) {
+  begin = std::min(begin, number.size());
+  end = std::min(end, number.size());
+  Vector slice(number.begin() + begin, number.begin() + end);
+  Trim(slice);
+  return slice;
+}
+
+/**
+ * @brief Divide 2 magnitudes con el algoritmo D de Knuth (división larga normalizada) y deja en quotient
+ * y remainder el cociente y el resto. Ambos operandos se multiplican por un factor que hace que el limb
+ * superior del divisor sea al menos R / 2, de forma que cada limb del cociente estimado a partir de los 2
+ * limbs superiores se corrige como mucho 2 veces. Coste O(n * m). El divisor no puede ser cero
+ *
+ * @tparam Base
+ * @param number_x
+ * @param number_y
+ * @param quotient
+ * @param remainder
+ */
+template <size_t Base>
+void Limbs<Base>::DivideBasecase(const Vector &number_x, const Vector &number_y, Vector &quotient,
+                                 Vector &remainder) {
+  if (Compare(number_x, number_y) < 0) {
+    remainder = number_x;
+    quotient.clear();
+    return;
+  }
+  if (number_y.size() == 1) {
+    quotient = number_x;
+    Limb rest = DivideSmall(quotient, number_y[0]);
+    remainder.assign(rest == 0 ? 0 : 1, rest);
+    return;
+  }
+
+  // normalización: d = floor(R / (v[n - 1] + 1))
+  const size_t size_y = number_y.size();
+  const Limb factor = static_cast<Limb>(kRadix / (static_cast<DoubleLimb>(number_y.back()) + 1));
+  Vector divisor = number_y;
+  Vector dividend = number_x;
+  MultiplySmall(divisor, factor, 0);
+  MultiplySmall(dividend, factor, 0);
+  dividend.resize(number_x.size() + 1, 0);
+
+  const Limb top = divisor[size_y - 1];
+  const Limb second = divisor[size_y - 2];
+  const int shift = __builtin_clzll(top);
+  const Limb top_inverse = Reciprocal(top << shift);
+  const Limb radix_mask = static_cast<Limb>(kRadix);  // 0 si R = 2^64
+
+  quotient.assign(dividend.size() - size_y, 0);
+  for (size_t j = quotient.size(); j > 0; j--) {
+    Limb *window = dividend.data() + j - 1;
+    // estimación del limb del cociente con los 2 limbs superiores y corrección con el tercero
+    Limb estimate;
+    DoubleLimb rest;
+    if (window[size_y] >= top) {
+      estimate = static_cast<Limb>(kRadix - 1);
+      rest = static_cast<DoubleLimb>(window[size_y]) * kRadix + window[size_y - 1] -
+             static_cast<DoubleLimb>(estimate) * top;
+    } else {
+      Limb rest_limb;
+      estimate = DivideNormalized(static_cast<DoubleLimb>(window[size_y]) * kRadix + window[size_y - 1],
+                                  top << shift, top_inverse, shift, rest_limb);
+      rest = rest_limb;
+    }
+    while (rest < kRadix &&
+           static_cast<DoubleLimb>(estimate) * second > rest * kRadix + window[size_y - 2]) {
+      estimate--;
+      rest += top;
+    }
+
+    // window[0..size_y] -= estimate * divisor
+    Limb carry = 0;
+    Limb borrow = 0;
+    for (size_t i = 0; i <= size_y; i++) {
+      Limb product = carry;
+      if (i < size_y) {
+        carry = SplitRadix(static_cast<DoubleLimb>(estimate) * divisor[i] + carry, product);
+      }
+      bool under = static_cast<DoubleLimb>(product) + borrow > window[i];
+      window[i] = window[i] - product - borrow + (under ? radix_mask : 0);
+      borrow = under ? 1 : 0;
+    }
+    // la estimación se pasó en 1 (poco probable): se suma de nuevo el divisor
+    if (borrow != 0) {
+      estimate--;
+      AddTo(window, size_y + 1, divisor.data(), size_y);
+    }
+    quotient[j - 1] = estimate;
+  }
+  Trim(quotient);
+
+  // el resto se desnormaliza dividiendo entre el factor (división exacta)
+  dividend.resize(size_y);
+  Trim(dividend);
+  DivideSmall(dividend, factor);
+  remainder = dividend;
+}
+
+/**
+ * @brief Convierte una magnitud binaria (limbs de 64 bits) a limbs de radix Base^k. Por encima de
+ * kConversionThreshold limbs se divide entre Radix^(2^k), con k tal que el número tenga a lo sumo
+ * 2^(k+1) limbs en el radix destino, y se convierten el cociente y el resto por separado. Con la división
+ * rápida el coste es O(M(n) log n) en lugar de cuadrático
+ *
+ * @tparam Base
+ * @param binary
+ * @return Vector
+ */
+template <size_t Base>
+typename Limbs<Base>::Vector Limbs<Base>::FromBinary(const Vector &binary) {
+  if (kRadixBits != 0) {  // radix potencia de 2: basta con reagrupar los bits
+    return Regroup(binary, 64, kRadixBits);
+  }
+  Vector number = binary;
+  Limbs<2>::Trim(number);
+  // como Radix >= 2^63, el número ocupa como mucho ceil(64 n / 63) limbs en el radix destino
+  size_t size = (64 * number.size() + 62) / 63;
+  size_t level = 0;
+  while ((static_cast<size_t>(2) << level) < size) {
+    level++;
+  }
+  Vector result(static_cast<size_t>(2) << level, 0);
+  BinaryPowers(level);
+  FromBinaryRecursive(number, level, result.data());
+  Trim(result);
+  return result;
+}
+
+/**
+ * @brief Convierte una magnitud en limbs de radix Base^k a binario (limbs de 64 bits). Por encima de
+ * kConversionThreshold limbs se parte en la mitad baja (2^k limbs) y la alta, y se recompone como
+ * alta * Radix^(2^k) + baja con la multiplicación rápida de Limbs<2>
+ *
+ * @tparam Base
+ * @param limbs
+ * @return Vector
+ */
+template <size_t Base>
+typename Limbs<Base>::Vector Limbs<Base>::ToBinary(const Vector &limbs) {
+  if (kRadixBits != 0) {
+    return Regroup(limbs, kRadixBits, 64);
+  }
+  size_t size = limbs.size();
+  while (size > 0 && limbs[size - 1] == 0) {
+    size--;
+  }
+  size_t level = 0;
+  while ((static_cast<size_t>(2) << level) < size) {
+    level++;
+  }
+  BinaryPowers(level);
+  return ToBinaryRecursive(limbs.data(), size, level);
+}
+
+/**
+ * @brief Valor de un carácter como dígito de la base ('0'-'9' y 'A'-'F'). Devuelve false si no es válido
+ *
+ * @tparam Base
+ * @param character
+ * @param digit
+ * @return true
+ * @return false
+ */
+template <size_t Base>
+bool Limbs<Base>::ParseDigit(char character, Limb &digit) {
+  if (character >= '0' && character <= '9') {
+    digit = character - '0';
+  } else if (character >= 'A' && character <= 'F') {
+    digit = character - 'A' + 10;
+  } else {
+    return false;
+  }
+  return digit < Base;
+}
+
+/**
+ * @brief Lee 8 caracteres a la vez cargados en una palabra de 64 bits (SWAR). Se valida que cada byte esté
+ * en el rango de dígitos de la base, se pasa cada byte a su valor y se combinan por parejas de bytes, de
+ * 16 y de 32 bits (d0 * Base + d1, ...) sin que ningún carril desborde en el siguiente
+ *
+ * @tparam Base
+ * @param chunk 8 caracteres, el primero el más significativo
+ * @param value valor menor que Base^8
+ * @return true
+ * @return false
+ */
+template <size_t Base>
+bool Limbs<Base>::ParseChunk(const char *chunk, Limb &value) {
+  const Limb ones = 0x0101010101010101;
+  const Limb high = 0x8080808080808080;
+  Limb word;
+  std::memcpy(&word, chunk, sizeof(word));
+  if (__BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__) {  // el primer carácter debe quedar en el byte bajo
+    word = __builtin_bswap64(word);
+  }
+  // bytes en [low, high]: (x + 0x80 - low) tiene el bit alto y (x + 0x7F - high) no lo tiene
+  Limb low7 = word & ~high;
+  Limb last = '0' + (Base < 10 ? Base : 10) - 1;
+  Limb valid = (low7 + (0x80 - '0') * ones) & ~(low7 + (0x7F - last) * ones);
+  if (Base > 10) {
+    valid |= (low7 + (0x80 - 'A') * ones) & ~(low7 + (0x7F - ('A' + Base - 11)) * ones);
+  }
+  if ((valid & ~word & high) != high) {
+    return false;
+  }
+  Limb digits = Base > 10 ? (word & 0x0F * ones) + 9 * ((word >> 6) & ones) : word - '0' * ones;
+  digits = (digits * Base + (digits >> 8)) & 0x00FF00FF00FF00FF;
+  digits = (digits * (Base * Base) + (digits >> 16)) & 0x0000FFFF0000FFFF;
+  value = (digits * (Base * Base * Base * Base) + (digits >> 32)) & 0xFFFFFFFF;
+  return true;
+}
+
+/**
+ * @brief Lee count caracteres (count <= kDigits) como un limb: de 8 en 8 y los restantes uno a uno
+ *
+ * @tparam Base
+ * @param number_str
+ * @param count
+ * @param value
+ * @return true
+ * @return false
+ */
+template <size_t Base>
+bool Limbs<Base>::ParseLimb(const char *number_str, size_t count, Limb &value) {
+  const Limb chunk_power = Base * Base * Base * Base * Base * Base * Base * Base;
+  value = 0;
+  size_t i = 0;
+  for (; i + kChunk <= count; i += kChunk) {
+    Limb chunk;
+    if (!ParseChunk(number_str + i, chunk)) {
+      return false;
+    }
+    value = value * chunk_power + chunk;
+  }
+  for (; i < count; i++) {
+    Limb digit;
+    if (!ParseDigit(number_str[i], digit)) {
+      return false;
+    }
+    value = value * Base + digit;
+  }
+  return true;
+}
+
+/**
+ * @brief Escribe 8 dígitos de un valor menor que Base^8 a la vez (SWAR): se parte en 2 mitades de 4 dígitos
+ * en carriles de 32 bits, cada una en 2 de 2 dígitos en carriles de 16 bits y cada una de ellas en 2 bytes.
+ * En base 10 las divisiones entre 100 y 10 se hacen con multiplicación por el inverso (exactas en ese rango)
+ *
+ * @tparam Base
+ * @param value
+ * @param chunk
+ */
+template <size_t Base>
+void Limbs<Base>::FormatChunk(Limb value, char *chunk) {
+  const Limb ones = 0x0101010101010101;
+  const Limb base2 = Base * Base;
+  const Limb base4 = base2 * base2;
+  Limb word = (value / base4) | ((value % base4) << 32);
+  Limb quotient;
+  if (Base == 10) {
+    quotient = ((word * 5243) >> 19) & 0x0000007F0000007F;  // x / 100 para x < 10^4
+  } else {
+    quotient = (word / base2) & 0x0000FFFF0000FFFF;  // potencia de 2: desplazamiento en cada carril
+  }
+  word = quotient | ((word - quotient * base2) << 16);
+  if (Base == 10) {
+    quotient = ((word * 103) >> 10) & 0x000F000F000F000F;  // x / 10 para x < 100
+  } else {
+    quotient = (word / Base) & 0x00FF00FF00FF00FF;
+  }
+  word = quotient | ((word - quotient * Base) << 8);
+  // los dígitos mayores que 9 se pasan a 'A'-'F' sumando 7 más
+  Limb letters = Base > 10 ? ((word + (0x80 - 10) * ones) >> 7) & ones : 0;
+  word += '0' * ones + 7 * letters;
+  if (__BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__) {
+    word = __builtin_bswap64(word);
+  }
+  std::memcpy(chunk, &word, sizeof(word));
+}
+
+/**
+ * @brief Escribe los count dígitos menos significativos de un limb en number_str, de 8 en 8 desde el final
+ *
+ * @tparam Base
+ * @param value
+ * @param count
+ * @param number_str
+ */
+template <size_t Base>
+void Limbs<Base>::FormatLimb(Limb value, size_t count, char *number_str) {
+  const Limb chunk_power = Base * Base * Base * Base * Base * Base * Base * Base;
+  for (; count >= kChunk; count -= kChunk) {
+    FormatChunk(value % chunk_power, number_str + count - kChunk);
+    value /= chunk_power;
+  }
+  for (; count > 0; count--) {
+    char digit = static_cast<char>(value % Base);
+    value /= Base;
+    number_str[count - 1] = digit < 10 ? digit + '0' : digit - 10 + 'A';
+  }
+}
+
+/**
+ * @brief Convierte una magnitud en limbs de Limbs<From> a limbs de esta base. Entre bases potencia de 2
+ * (2, 8 y 16) se reagrupan los bits directamente en una pasada; en otro caso se pasa por binario
+ *
+ * @tparam Base
+ * @tparam From
+ * @param limbs
+ * @return Vector
+ */
+template <size_t Base>
+template <size_t From>
+typename Limbs<Base>::Vector Limbs<Base>::Convert(const Vector &limbs) {
+  if (Limbs<From>::kRadix == kRadix) {
+    Vector result = limbs;
+    Trim(result);
+    return result;
+  }
+  if (Limbs<From>::kRadixBits != 0 && kRadixBits != 0) {
+    return Regroup(limbs, Limbs<From>::kRadixBits, kRadixBits);
+  }
+  return FromBinary(Limbs<From>::ToBinary(limbs));
+}
+
+/**
+ * @brief Reagrupa una magnitud en limbs de bits_from bits a limbs de bits_to bits (ambos entre 1 y 64)
+ * en una sola pasada, con un acumulador de 128 bits. Sirve para los radix potencia de 2
+ *
+ * @tparam Base
+ * @param limbs
+ * @param bits_from
+ * @param bits_to
+ * @return Vector
+ */
+template <size_t Base>
+typename Limbs<Base>::Vector Limbs<Base>::Regroup(const Vector &limbs, unsigned bits_from, unsigned bits_to) {
+  Vector result;
+  result.reserve((limbs.size() * bits_from + bits_to - 1) / bits_to);
+  const DoubleLimb mask = (static_cast<DoubleLimb>(1) << bits_to) - 1;
+  DoubleLimb buffer = 0;
+  unsigned filled = 0;
+  for (size_t i = 0; i < limbs.size(); i++) {
+    buffer |= static_cast<DoubleLimb>(limbs[i]) << filled;
+    filled += bits_from;
+    while (filled >= bits_to) {
+      result.push_back(static_cast<Limb>(buffer & mask));
+      buffer >>= bits_to;
+      filled -= bits_to;
+    }
+  }
+  if (filled > 0) {
+    result.push_back(static_cast<Limb>(buffer));
+  }
+  Trim(result);
+  return result;
+}
+
+/**
+ * @brief Devuelve la tabla de potencias Radix^(2^k) en binario con al menos level + 1 entradas. La tabla
+ * se guarda entre llamadas, por lo que cada potencia se calcula (elevando al cuadrado la anterior) una
+ * sola vez en todo el programa
+ *
+ * @tparam Base
+ * @param level
+ * @return const std::vector<Vector>&
+ */
+template <size_t Base>
+const std::vector<typename Limbs<Base>::Vector> &Limbs<Base>::BinaryPowers(size_t level) {
+  static std::vector<Vector> powers;
+  if (powers.empty()) {
+    Vector radix;
+    radix.push_back(static_cast<Limb>(kRadix));
+    if (kRadix >> 64 != 0) {
+      radix.push_back(static_cast<Limb>(kRadix >> 64));
+    }
+    powers.push_back(radix);
+  }
+  while (powers.size() <= level) {
+    powers.push_back(Limbs<2>::Multiply(powers.back(), powers.back()));
+  }
+  return powers;
+}
+
+/**
+ * @brief Paso recursivo de FromBinary: number < Radix^(2^(level+1)) y se escriben sus 2^(level+1) limbs
+ * en result. La tabla de potencias debe tener ya el nivel level
+ *
+ * @tparam Base
+ * @param number
+ * @param level
+ * @param result
+ */
+template <size_t Base>
+void Limbs<Base>::FromBinaryRecursive(const Vector &number, size_t level, Limb *result) {
+  size_t size = static_cast<size_t>(2) << level;
+  if (size <= kConversionThreshold) {
+    Vector remaining = number;
+    for (size_t i = 0; i < size && !remaining.empty(); i++) {
+      result[i] = Limbs<2>::DivideSmall(remaining, static_cast<Limb>(kRadix));
+    }
+    return;
+  }
+  Vector quotient, remainder;
+  Limbs<2>::Divide(number, BinaryPowers(level)[level], quotient, remainder);
+  FromBinaryRecursive(remainder, level - 1, result);
+  FromBinaryRecursive(quotient, level - 1, result + size / 2);
+}
+
+/**
+ * @brief Paso recursivo de ToBinary sobre los size limbs de number, con size <= 2^(level+1)
+ *
+ * @tparam Base
+ * @param number
+ * @param size
+ * @param level
+ * @return Vector
+ */
+template <size_t Base>
+typename Limbs<Base>::Vector Limbs<Base>::ToBinaryRecursive(const Limb *number, size_t size, size_t level) {
+  if (size <= kConversionThreshold) {
+    // Horner limb a limb desde el más significativo
+    Vector result;
+    result.reserve(size + 1);
+    for (size_t i = size; i > 0; i--) {
+      Limbs<2>::MultiplySmall(result, static_cast<Limb>(kRadix), number[i - 1]);
+    }
+    return result;
+  }
+  size_t half = static_cast<size_t>(1) << level;
+  if (size <= half) {
+    return ToBinaryRecursive(number, size, level - 1);
+  }
+  Vector high = ToBinaryRecursive(number + half, size - half, level - 1);
+  Vector low = ToBinaryRecursive(number, half, level - 1);
+  Vector result = Limbs<2>::Multiply(high, BinaryPowers(level)[level]);
+  return Limbs<2>::Add(result, low);
+}
+
+/**
+ * @brief Multiplica 2 magnitudes con la transformada teórica de números (NTT). Los limbs son los
+ * coeficientes de 2 polinomios en R; su convolución se calcula de forma exacta módulo 3 primos de 62 bits
+ * (aritmética de Montgomery) y cada coeficiente se reconstruye con el teorema chino del resto (Garner).
+ * Como cada coeficiente es menor que size_y * R^2 < p0 * p1 * p2, la reconstrucción es exacta. Al final se
+ * propagan los acarreos en radix R. Coste O(n log n)
+ *
+ * @tparam Base
+ * @param result
+ * @param number_x
+ * @param size_x
+ * @param number_y
+ * @param size_y
+ */
+template <size_t Base>
+void Limbs<Base>::MultiplyNtt(Limb *result, const Limb *number_x, size_t size_x, const Limb *number_y,
+                              size_t size_y) {
+  // p - 1 es divisible por 2^55 en los 3 casos, lo que limita la longitud de la transformada
+  const NttPrime primes[3] = {MakePrime(4179340454199820289ULL, 3), MakePrime(2485986994308513793ULL, 5),
+                              MakePrime(1945555039024054273ULL, 5)};
+  size_t length = 1;
+  while (length < size_x + size_y - 1) {
+    length <<= 1;
+  }
+  Vector residues[3];
+  for (int k = 0; k < 3; k++) {
+    residues[k] = Convolve(number_x, size_x, number_y, size_y, length, primes[k]);
+  }
+
+  // constantes de Garner en forma de Montgomery: p0^-1 mod p1, p0 mod p2 y (p0 * p1)^-1 mod p2
+  const Limb p0 = primes[0].modulus;
+  const Limb p1 = primes[1].modulus;
+  const Limb p2 = primes[2].modulus;
+  const Limb inverse_01 = MontgomeryPower(MontgomeryReduce(static_cast<DoubleLimb>(p0) * primes[1].r2, primes[1]),
+                                          p1 - 2, primes[1]);
+  const Limb p0_mod_2 = MontgomeryReduce(static_cast<DoubleLimb>(p0) * primes[2].r2, primes[2]);
+  const Limb p1_mod_2 = MontgomeryReduce(static_cast<DoubleLimb>(p1) * primes[2].r2, primes[2]);
+  const Limb inverse_012 = MontgomeryPower(MontgomeryMultiply(p0_mod_2, p1_mod_2, primes[2]), p2 - 2, primes[2]);
+  const DoubleLimb p01 = static_cast<DoubleLimb>(p0) * p1;
+  const Limb p01_low = static_cast<Limb>(p01);
+  const Limb p01_high = static_cast<Limb>(p01 >> 64);
+
+  // acarreo de 3 palabras de 64 bits (carry[0] la menos significativa)
+  Limb carry[3] = {0, 0, 0};
+  for (size_t i = 0; i < size_x + size_y; i++) {
+    if (i < size_x + size_y - 1) {
+      // c = r0 + x1 * p0 + x2 * p0 * p1, con x1 < p1 y x2 < p2
+      Limb r0 = residues[0][i];
+      Limb x1 = MontgomeryMultiply(residues[1][i] + 4 * p1 - r0, inverse_01, primes[1]);
+      Limb y = MontgomeryMultiply(x1, p0_mod_2, primes[2]);
+      Limb x2 = MontgomeryMultiply(residues[2][i] + (p2 - y) + (3 * p2 - r0), inverse_012, primes[2]);
+      DoubleLimb low = static_cast<DoubleLimb>(x1) * p0 + r0;
+      DoubleLimb high_0 = static_cast<DoubleLimb>(x2) * p01_low;
+      DoubleLimb high_1 = static_cast<DoubleLimb>(x2) * p01_high + (high_0 >> 64);
+      DoubleLimb sum = static_cast<DoubleLimb>(carry[0]) + static_cast<Limb>(low) + static_cast<Limb>(high_0);
+      carry[0] = static_cast<Limb>(sum);
+      sum = (sum >> 64) + carry[1] + static_cast<Limb>(low >> 64) + static_cast<Limb>(high_1);
+      carry[1] = static_cast<Limb>(sum);
+      carry[2] += static_cast<Limb>(sum >> 64) + static_cast<Limb>(high_1 >> 64);
+    }
+    // división larga del acarreo entre el radix: el resto es el limb i del resultado
+    Limb remainder;
+    carry[2] = SplitRadix(carry[2], remainder);
+    carry[1] = SplitRadix((static_cast<DoubleLimb>(remainder) << 64) | carry[1], remainder);
+    carry[0] = SplitRadix((static_cast<DoubleLimb>(remainder) << 64) | carry[0], remainder);
+    result[i] = remainder;
+  }
+}
+
+/**
+ * @brief Calcula las constantes de Montgomery de un primo de la NTT
+ *
+ * @tparam Base
+ * @param modulus
+ * @param generator
+ * @return NttPrime
+ */
+template <size_t Base>
+typename Limbs<Base>::NttPrime Limbs<Base>::MakePrime(Limb modulus, Limb generator) {
+  NttPrime prime;
+  prime.modulus = modulus;
+  prime.generator = generator;
+  // inverso módulo 2^64 por Newton: cada iteración duplica los bits correctos (p * p = 1 mod 8)
+  Limb inverse = modulus;
+  for (int i = 0; i < 5; i++) {
+    inverse *= 2 - modulus * inverse;
+  }
+  prime.inverse = -inverse;
+  prime.r2 = static_cast<Limb>((~static_cast<DoubleLimb>(0) % modulus + 1) % modulus);
+  return prime;
+}
+
+/**
+ * @brief Reducción de Montgomery: devuelve value / R mod p para value < p * R
+ *
+ * @tparam Base
+ * @param value
+ * @param prime
+ * @return Limb
+ */
+template <size_t Base>
+typename Limbs<Base>::Limb Limbs<Base>::MontgomeryReduce(DoubleLimb value, const NttPrime &prime) {
+  Limb factor = static_cast<Limb>(value) * prime.inverse;
+  Limb reduced = static_cast<Limb>((value + static_cast<DoubleLimb>(factor) * prime.modulus) >> 64);
+  return reduced >= prime.modulus ? reduced - prime.modulus : reduced;
+}
+
+/**
+ * @brief Producto de Montgomery: x * y / R mod p. Basta con que uno de los factores sea menor que p
+ *
+ * @tparam Base
+ * @param number_x
+ * @param number_y
+ * @param prime
+ * @return Limb
+ */
+template <size_t Base>
+typename Limbs<Base>::Limb Limbs<Base>::MontgomeryMultiply(Limb number_x, Limb number_y, const NttPrime &prime) {
+  return MontgomeryReduce(static_cast<DoubleLimb>(number_x) * number_y, prime);
+}
+
+/**
+ * @brief Potencia de un valor en forma de Montgomery, por cuadrados sucesivos
+ *
+ * @tparam Base
+ * @param number
+ * @param exponent
+ * @param prime
+ * @return Limb
+ */
+template <size_t Base>
+typename Limbs<Base>::Limb Limbs<Base>::MontgomeryPower(Limb number, Limb exponent, const NttPrime &prime) {
+  Limb power = MontgomeryReduce(prime.r2, prime);  // 1 en forma de Montgomery
+  while (exponent != 0) {
+    if (exponent & 1) {
+      power = MontgomeryMultiply(power, number, prime);
+    }
+    number = MontgomeryMultiply(number, number, prime);
+    exponent >>= 1;
+  }
+  return power;
+}
+
+/**
+ * @brief Tabla de raíces para una transformada de longitud length: la posición half + j guarda w^j, con
+ * w raíz primitiva 2 * half-ésima de la unidad (root es una raíz primitiva length-ésima)
+ *
+ * @tparam Base
+ * @param length
+ * @param root
+ * @param prime
+ * @return Vector
+ */
+template <size_t Base>
+typename Limbs<Base>::Vector Limbs<Base>::Roots(size_t length, Limb root, const NttPrime &prime) {
+  Vector roots(std::max<size_t>(length, 2));
+  size_t half = length / 2;
+  roots[half] = MontgomeryReduce(prime.r2, prime);
+  for (size_t j = 1; j < half; j++) {
+    roots[half + j] = MontgomeryMultiply(roots[half + j - 1], root, prime);
+  }
+  for (size_t i = half; i > 1; i--) {
+    roots[i - 1] = roots[2 * (i - 1)];
+  }
+  return roots;
+}
+
+/**
+ * @brief NTT en el sitio. La directa (decimación en frecuencia) deja el resultado en orden de bits
+ * invertido y la inversa (decimación en tiempo) lo recibe en ese orden, así que no hace falta permutar
+ *
+ * @tparam Base
+ * @param values
+ * @param roots
+ * @param prime
+ * @param inverse
+ */
+template <size_t Base>
+void Limbs<Base>::Transform(Vector &values, const Vector &roots, const NttPrime &prime, bool inverse) {
+  const Limb modulus = prime.modulus;
+  const size_t length = values.size();
+  if (!inverse) {
+    for (size_t half = length / 2; half >= 1; half /= 2) {
+      for (size_t start = 0; start < length; start += 2 * half) {
+        for (size_t j = 0; j < half; j++) {
+          Limb u = values[start + j];
+          Limb v = values[start + j + half];
+          Limb sum = u + v;
+          values[start + j] = sum >= modulus ? sum - modulus : sum;
+          values[start + j + half] = MontgomeryMultiply(u >= v ? u - v : u + modulus - v, roots[half + j], prime);
+        }
+      }
+    }
+  } else {
+    for (size_t half = 1; half < length; half *= 2) {
+      for (size_t start = 0; start < length; start += 2 * half) {
+        for (size_t j = 0; j < half; j++) {
+          Limb u = values[start + j];
+          Limb v = MontgomeryMultiply(values[start + j + half], roots[half + j], prime);
+          Limb sum = u + v;
+          values[start + j] = sum >= modulus ? sum - modulus : sum;
+          values[start + j + half] = u >= v ? u - v : u + modulus - v;
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief Convolución cíclica de longitud length de 2 magnitudes módulo un primo. Devuelve los
+ * coeficientes en forma normal (no Montgomery). Si ambos operandos son el mismo se transforma una vez
+ *
+ * @tparam Base
+ * @param number_x
+ * @param size_x
+ * @param number_y
+ * @param size_y
+ * @param length
+ * @param prime
+ * @return Vector
+ */
+template <size_t Base>
+typename Limbs<Base>::Vector Limbs<Base>::Convolve(const Limb *number_x, size_t size_x, const Limb *number_y,
+                                                   size_t size_y, size_t length, const NttPrime &prime) {
+  const Limb root = MontgomeryPower(MontgomeryReduce(static_cast<DoubleLimb>(prime.generator) * prime.r2, prime),
+                                    (prime.modulus - 1) / length, prime);
+  const Limb root_inverse = MontgomeryPower(root, prime.modulus - 2, prime);
+
+  // cualquier limb (< 2^64) pasa a forma de Montgomery con un producto por R^2
+  Vector values_x(length, 0);
+  for (size_t i = 0; i < size_x; i++) {
+    values_x[i] = MontgomeryMultiply(number_x[i], prime.r2, prime);
+  }
+  Vector roots = Roots(length, root, prime);
+  Transform(values_x, roots, prime, false);
+  if (number_x == number_y && size_x == size_y) {
+    for (size_t i = 0; i < length; i++) {
+      values_x[i] = MontgomeryMultiply(values_x[i], values_x[i], prime);
+    }
+  } else {
+    Vector values_y(length, 0);
+    for (size_t i = 0; i < size_y; i++) {
+      values_y[i] = MontgomeryMultiply(number_y[i], prime.r2, prime);
+    }
+    Transform(values_y, roots, prime, false);
+    for (size_t i = 0; i < length; i++) {
+      values_x[i] = MontgomeryMultiply(values_x[i], values_y[i], prime);
+    }
+  }
+  Transform(values_x, Roots(length, root_inverse, prime), prime, true);
+
+  // el producto por length^-1 (en forma normal) deshace a la vez la escala y la forma de Montgomery
+  Limb length_inverse = MontgomeryReduce(
+      MontgomeryPower(MontgomeryMultiply(length, prime.r2, prime), prime.modulus - 2, prime), prime);
+  for (size_t i = 0; i < length; i++) {
+    values_x[i] = MontgomeryMultiply(values_x[i], length_inverse, prime);
+  }
+  return values_x;
+}
+
+#endif  // LIMBS_CC
@@ -3,12 +3,783 @@
  *
  */
 
+#include <cstdlib>
 #include <iostream>
+#include <map>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
 
 #include "..\include\number.h"
 #include "..\include\bigint.h"
+#include "..\include\calculator.h"
 #include "number.cc"
 
+// contador de reservas de memoria dinámica para comprobar que los operadores no hacen copias ocultas
+static size_t allocations = 0;
+
+void* operator new(size_t size) {
+  allocations++;
+  void* pointer = std::malloc(size == 0 ? 1 : size);
+  if (pointer == nullptr) {
+    throw std::bad_alloc();
+  }
+  return pointer;
+}
+
+void operator delete(void* pointer) noexcept {
+  std::free(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept {
+  std::free(pointer);
+}
+
+/**
+ * @brief Cuenta las reservas de memoria de la expresión a + b - c. Cada resultado (el temporal de la
+ * suma y el de la resta) debe reservar a lo sumo una vez; los movimientos no deben reservar.
+ *
+ * @tparam T tipo de los operandos
+ * @param a
+ * @param b
+ * @param c
+ * @return true si no se superan las dos reservas
+ */
+template <class T>
+bool CheckAllocations(const T& a, const T& b, const T& c) {
+  allocations = 0;
+  T result = a + b - c;
+  size_t count = allocations;
+  T moved = std::move(result);
+  bool moved_ok = allocations == count;
+  return count <= 2 && moved_ok;
+}
+
+// número de comprobaciones fallidas
+static size_t failures = 0;
+
+/**
+ * @brief Comprueba una condición: muestra la descripción con su resultado y cuenta los fallos
+ *
+ * @param description
+ * @param condition
+ */
+void Check(const std::string& description, bool condition) {
+  std::cout << (condition ? "OK: " : "FALLO: ") << description << std::endl;
+  if (!condition) {
+    failures++;
+  }
+}
+
+/**
+ * @brief Comprueba si una operación lanza la excepción indicada
+ *
+ * @tparam Exception
+ * @tparam Operation
+ * @param operation
+ * @return true si se lanza Exception
+ */
+template <class Exception, class Operation>
+bool Throws(Operation operation) {
+  try {
+    operation();
+  } catch (Exception&) {
+    return true;
+  }
+  return false;
+}
+
+/**
+ * @brief Valor en base 10 de un número, para comparar resultados entre bases sin depender del ancho
+ *
+ * @tparam T
+ * @param number
+ * @return std::string
+ */
+template <class T>
+std::string Decimal(const T& number) {
+  return static_cast<BigInt<10>>(number).to_string();
+}
+
+/**
+ * @brief Texto de un Number tal como lo escribe la calculadora
+ *
+ * @param number
+ * @return std::string
+ */
+std::string Text(const Number* number) {
+  std::ostringstream output;
+  output << *number;
+  return output.str();
+}
+
+/**
+ * @brief Ejecuta unas líneas en la calculadora y devuelve el valor de cada variable como texto
+ *
+ * @param lines
+ * @return std::map<std::string, std::string>
+ */
+std::map<std::string, std::string> Calculate(const std::vector<std::string>& lines) {
+  std::vector<std::vector<std::string>> tokens;
+  for (auto& line : lines) {
+    std::istringstream iss(line);
+    std::vector<std::string> line_tokens;
+    std::string token;
+    while (iss >> token) {
+      line_tokens.push_back(token);
+    }
+    tokens.push_back(line_tokens);
+  }
+  Calculator<Number*> calculator;
+  calculator.SetTokens(tokens);
+  calculator.Process();
+  std::stringstream output;
+  output << calculator;
+  std::map<std::string, std::string> values;
+  std::string name, equals, value;
+  while (output >> name >> equals >> value) {
+    values[name] = value;
+  }
+  return values;
+}
+
+/**
+ * @brief Cadena pseudoaleatoria (generador congruencial) de count símbolos de digits, sin ceros por la
+ * izquierda, para construir operandos con un número exacto de limbs
+ *
+ * @param count
+ * @param digits
+ * @param seed
+ * @return std::string
+ */
+std::string RandomDigits(size_t count, const std::string& digits, uint64_t seed) {
+  std::string result;
+  for (size_t i = 0; i < count; i++) {
+    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    result += digits[(seed >> 33) % digits.size()];
+  }
+  if (result[0] == '0') {
+    result[0] = digits.back();
+  }
+  return result;
+}
+
+/**
+ * @brief Comprueba un producto sin repetir el algoritmo que lo calcula: (x y) / y = x con resto 0 y el
+ * resto módulo un número de un limb coincide con el producto de los restos
+ *
+ * @tparam T
+ * @param x
+ * @param y
+ * @param modulus
+ * @return true si el producto es correcto
+ */
+template <class T>
+bool ProductIsRight(const T& x, const T& y, const T& modulus) {
+  T product = x * y;
+  return product / y == x && product % y == T() && product % modulus == (x % modulus) * (y % modulus) % modulus;
+}
+
+/**
+ * @brief División truncada (algoritmo D de Knuth): el cociente redondea hacia 0 y el resto toma el signo
+ * del dividendo, en todas las bases. Incluye divisores de varios limbs con corrección del cociente estimado
+ * y la división entre 0
+ */
+void CheckDivision() {
+  const char* dividends[] = {"7", "-7", "7", "-7"};
+  const char* divisors[] = {"2", "2", "-2", "-2"};
+  const char* quotients[] = {"3", "-3", "-3", "3"};
+  const char* remainders[] = {"1", "-1", "1", "-1"};
+  for (int i = 0; i < 4; i++) {
+    BigInt<10> x(dividends[i]), y(divisors[i]);
+    std::string operation = std::string(dividends[i]) + " / " + divisors[i];
+    Check("base 10: " + operation, (x / y).to_string() == quotients[i] && (x % y).to_string() == remainders[i]);
+    BigInt<2> x_binary = static_cast<BigInt<2>>(x), y_binary = static_cast<BigInt<2>>(y);
+    Check("base 2: " + operation, Decimal(x_binary / y_binary) == quotients[i] &&
+                                      Decimal(x_binary % y_binary) == remainders[i]);
+    BigInt<16> x_hexadecimal = static_cast<BigInt<16>>(x), y_hexadecimal = static_cast<BigInt<16>>(y);
+    Check("base 16: " + operation, Decimal(x_hexadecimal / y_hexadecimal) == quotients[i] &&
+                                       Decimal(x_hexadecimal % y_hexadecimal) == remainders[i]);
+  }
+
+  BigInt<10> x("340282366920938463463374607431768211455"), y("18446744073709551617");
+  Check("(2^128 - 1) / (2^64 + 1)", (x / y).to_string() == "18446744073709551615" && (x % y).IsZero());
+  x = BigInt<10>("999999999999999999999999999999999999999999999999999999999");
+  y = BigInt<10>("10000000000000000001");
+  Check("(10^57 - 1) / (10^19 + 1)", (x / y).to_string() == "99999999999999999990000000000000000000" &&
+                                         (x % y).to_string() == "9999999999999999999");
+  BigInt<16> x_hexadecimal("FFFFFFFFFFFFFFFF0000000000000000FFFFFFFFFFFFFFFF");
+  BigInt<16> y_hexadecimal("FFFFFFFFFFFFFFFF0000000000000001");
+  Check("base 16: cociente estimado con corrección",
+        (x_hexadecimal / y_hexadecimal).to_string() == "FFFFFFFFFFFFFFFF" &&
+            (x_hexadecimal % y_hexadecimal).to_string() == "FFFFFFFFFFFFFFFF0000000000000000");
+  x = BigInt<10>("-123456789012345678901234567890123456789");
+  y = BigInt<10>("98765432109876543210");
+  Check("dividendo negativo de varios limbs", (x / y).to_string() == "-1249999988609375000" &&
+                                                  (x % y).to_string() == "-15297067891529706789");
+
+  BigInt<10> zero("0");
+  Check("base 10: división entre 0", Throws<BigIntDivisionByZero>([&] { return x / zero; }) &&
+                                          Throws<BigIntDivisionByZero>([&] { return x % zero; }));
+  BigInt<2> zero_binary("0"), x_binary("0101");
+  Check("base 2: división entre 0", Throws<BigIntDivisionByZero>([&] { return x_binary / zero_binary; }) &&
+                                         Throws<BigIntDivisionByZero>([&] { return x_binary % zero_binary; }));
+}
+
+/**
+ * @brief División recursiva de Burnikel-Ziegler: divisor y cociente por encima del umbral en limbs. El
+ * dividendo se construye como q * y + r con q, y, r conocidos, en base 10 y en base 2
+ */
+void CheckLargeDivision() {
+  BigInt<10> y = (BigInt<10>("7") ^ BigInt<10>("1000")) + BigInt<10>("12345");  // 846 dígitos
+  BigInt<10> q = BigInt<10>("3") ^ BigInt<10>("2000");                           // 955 dígitos
+  BigInt<10> r = BigInt<10>("5") ^ BigInt<10>("900");                            // 630 dígitos
+  BigInt<10> x = q * y + r;
+  Check("base 10: división de Burnikel-Ziegler", x / y == q && x % y == r);
+  Check("base 10: división de Burnikel-Ziegler con signo", (-x) / y == -q && (-x) % y == -r &&
+                                                               x / (-y) == -q && x % (-y) == r);
+  std::pair<BigInt<10>, BigInt<10>> result = x.DivMod(y);
+  Check("base 10: DivMod de Burnikel-Ziegler", result.first == q && result.second == r);
+
+  BigInt<2> y_binary = static_cast<BigInt<2>>(BigInt<10>("3") ^ BigInt<10>("4000"));  // 6341 bits
+  BigInt<2> q_binary = static_cast<BigInt<2>>(BigInt<10>("5") ^ BigInt<10>("3000"));  // 6967 bits
+  BigInt<2> r_binary = static_cast<BigInt<2>>(BigInt<10>("7") ^ BigInt<10>("2000"));  // 5616 bits
+  BigInt<2> x_binary = q_binary * y_binary + r_binary;
+  Check("base 2: división de Burnikel-Ziegler", x_binary / y_binary == q_binary && x_binary % y_binary == r_binary);
+}
+
+/**
+ * @brief Cociente y resto a la vez: DivMod, Number::divmod y el token /% de la calculadora, que apila el
+ * cociente y encima el resto (se comprueban sumándolos y restándolos)
+ */
+void CheckDivMod() {
+  std::pair<BigInt<10>, BigInt<10>> result = BigInt<10>("-7").DivMod(BigInt<10>("2"));
+  Check("DivMod(-7, 2)", result.first.to_string() == "-3" && result.second.to_string() == "-1");
+
+  Number* x = Number::create(16, "-FF");
+  Number* y = Number::create(2, "0101");
+  std::pair<Number*, Number*> pair = x->divmod(y);
+  Check("divmod(-FF en base 16, 0101 en base 2)", Text(pair.first) == "-33" && Text(pair.second) == "0");
+  delete pair.first;
+  delete pair.second;
+  delete x;
+  delete y;
+
+  std::map<std::string, std::string> values = Calculate({"A = 10, -7", "B = 10, 2", "Z = 10, 0",
+                                                         "S ? A B /% +", "D ? A B /% -", "E ? A Z /%"});
+  Check("calculadora: A B /% apila -3 y -1", values["S"] == "-4" && values["D"] == "-2");
+  Check("calculadora: /% entre 0 da 0", values["E"] == "0");
+}
+
+/**
+ * @brief Cambios de base: reagrupación de bits entre 2, 8 y 16, cambio divide y vencerás desde y hacia la
+ * base 10 (por encima del umbral de conversión limb a limb) y complemento a 2 al pasar por BigInt<2>
+ */
+void CheckConversions() {
+  Check("-FF en base 16 a base 8", static_cast<BigInt<8>>(BigInt<16>("-FF")).to_string() == "-377");
+  Check("1001 en base 2 (complemento a 2) a base 10", Decimal(BigInt<2>("1001")) == "-7");
+  Check("-FF en base 16 a base 2", Decimal(static_cast<BigInt<2>>(BigInt<16>("-FF"))) == "-255");
+
+  BigInt<10> power = BigInt<10>("2") ^ BigInt<10>("1000");
+  Check("2^1000 de base 10 a base 16", static_cast<BigInt<16>>(power).to_string() == "1" + std::string(250, '0'));
+  Check("2^1000 de base 10 a base 8", static_cast<BigInt<8>>(power).to_string() == "2" + std::string(333, '0'));
+
+  BigInt<10> number = -(BigInt<10>("3") ^ BigInt<10>("5000")) + BigInt<10>("12345");  // 2386 dígitos
+  BigInt<16> hexadecimal = static_cast<BigInt<16>>(number);
+  BigInt<8> octal = static_cast<BigInt<8>>(hexadecimal);
+  BigInt<2> binary = static_cast<BigInt<2>>(octal);
+  Check("ida y vuelta 10 -> 16 -> 8 -> 2 -> 10", static_cast<BigInt<10>>(binary) == number &&
+                                                     static_cast<BigInt<10>>(hexadecimal) == number &&
+                                                     static_cast<BigInt<10>>(octal) == number);
+  Check("ida y vuelta 2 -> 16 -> 2", static_cast<BigInt<2>>(static_cast<BigInt<16>>(binary)) == binary);
+}
+
+/**
+ * @brief Desplazamientos: por dígitos de la base en BigInt<Base>, aritmético en BigInt<2> (redondea hacia
+ * abajo con los negativos) y rechazo de cantidades negativas o demasiado grandes
+ */
+void CheckShifts() {
+  BigInt<10> decimal("-12345");
+  decimal <<= 3;
+  Check("-12345 << 3 en base 10", decimal.to_string() == "-12345000");
+  decimal >>= 5;
+  Check("-12345000 >> 5 en base 10 trunca hacia 0", decimal.to_string() == "-123");
+  BigInt<16> hexadecimal("ABC");
+  hexadecimal >>= 10;
+  Check("ABC >> 10 en base 16 da 0", hexadecimal.to_string() == "0");
+
+  BigInt<2> binary("1001");  // -7
+  binary >>= 1;
+  Check("-7 >> 1 en base 2 redondea hacia abajo", Decimal(binary) == "-4");
+  binary >>= 100;
+  Check("-4 >> 100 en base 2 da -1", Decimal(binary) == "-1");
+  binary <<= 70;
+  Check("-1 << 70 en base 2", Decimal(binary) == "-1180591620717411303424");
+  BigInt<2> positive("0101");
+  BigInt<2> negative("1011");
+  positive >>= static_cast<size_t>(-1);
+  negative >>= static_cast<size_t>(-2);
+  Check("0101 >> (2^64 - 1) y 1011 >> (2^64 - 2) dejan el ancho mínimo de 2 bits",
+        positive.to_string() == "00" && negative.to_string() == "11");
+  BigInt<2> maximum = static_cast<BigInt<2>>(BigInt<10>("18446744073709551615"));
+  Number* shifted = BigInt<2>("0101").shiftRight(&maximum);
+  Check("0101 >> (2^64 - 1) con shiftRight", Text(shifted) == "00");
+  delete shifted;
+
+  BigInt<10> five("5");
+  BigInt<10> minus_one("-1");
+  BigInt<10> huge("100000000000000000000");  // no cabe en size_t
+  Check("desplazamiento negativo lanza BigIntOutOfRange",
+        Throws<BigIntOutOfRange>([&]() { delete five.shiftLeft(&minus_one); }) &&
+            Throws<BigIntOutOfRange>([&]() { delete five.shiftRight(&minus_one); }));
+  Check("desplazamiento que no cabe en size_t lanza BigIntOutOfRange",
+        Throws<BigIntOutOfRange>([&]() { delete five.shiftLeft(&huge); }) &&
+            Throws<BigIntOutOfRange>([&]() { delete five.shiftRight(&huge); }));
+  BigInt<2> binary_five("0101");
+  BigInt<2> binary_minus_one("1");
+  Check("desplazamiento negativo en base 2 lanza BigIntOutOfRange",
+        Throws<BigIntOutOfRange>([&]() { delete binary_five.shiftLeft(&binary_minus_one); }));
+
+  std::map<std::string, std::string> values =
+      Calculate({"A = 10, 5", "T = 10, 2", "N = 10, -1", "G = 10, 2000000000", "H = 16, FFFFFFFFFFFFFFFFFF",
+                 "L ? A T <<", "R ? A T >>", "M ? A N <<", "B ? A G <<", "C ? A H >>", "D ? A T << T >>"});
+  Check("calculadora: 5 << 2 y 5 >> 2", values["L"] == "500" && values["R"] == "0");
+  Check("calculadora: cantidad negativa o demasiado grande da 0",
+        values["M"] == "0" && values["B"] == "0" && values["C"] == "0");
+  Check("calculadora: las líneas siguientes a un error se calculan", values["D"] == "5");
+}
+
+/**
+ * @brief Operaciones lógicas en complemento a 2 con extensión de signo infinita: valores pequeños,
+ * identidades con operandos de distinto ancho en BigInt<2> y mismo resultado en base 10 que en base 2
+ */
+void CheckBitwise() {
+  BigInt<10> twelve("12");
+  BigInt<10> minus_five("-5");
+  Number* result_and = twelve.bitAnd(&minus_five);
+  Number* result_or = twelve.bitOr(&minus_five);
+  Number* result_xor = twelve.bitXor(&minus_five);
+  Number* result_not = twelve.bitNot();
+  Check("12 & -5, 12 | -5, 12 ~^ -5 y ~12 en base 10", Text(result_and) == "8" && Text(result_or) == "-1" &&
+                                                        Text(result_xor) == "-9" && Text(result_not) == "-13");
+  delete result_and;
+  delete result_or;
+  delete result_xor;
+  delete result_not;
+
+  // 3^200 ocupa 5 palabras, -(7^50) 3 y -2^64 2: recorren tanto el bucle vectorial como la extensión de signo
+  BigInt<10> values[] = {BigInt<10>("3") ^ BigInt<10>("200"), -(BigInt<10>("7") ^ BigInt<10>("50")),
+                         -(BigInt<10>("2") ^ BigInt<10>("64")), BigInt<10>("-1"), BigInt<10>("0")};
+  bool identities = true;
+  bool same_as_decimal = true;
+  for (auto& x : values) {
+    BigInt<2> a = static_cast<BigInt<2>>(x);
+    identities = identities && ~a == -a - BigInt<2>("01") && (a & static_cast<BigInt<2>>(BigInt<10>("-1"))) == a;
+    for (auto& y : values) {
+      BigInt<2> b = static_cast<BigInt<2>>(y);
+      BigInt<2> both = a & b;
+      BigInt<2> any = a | b;
+      BigInt<2> different = a.Xor(b);
+      identities = identities && both + any == a + b && different == any - both && both == (b & a);
+      Number* decimal_and = x.bitAnd(&y);
+      Number* decimal_xor = x.bitXor(&y);
+      same_as_decimal =
+          same_as_decimal && Text(decimal_and) == Decimal(both) && Text(decimal_xor) == Decimal(different);
+      delete decimal_and;
+      delete decimal_xor;
+    }
+  }
+  Check("identidades de &, |, ~^ y ~ con anchos distintos en base 2", identities);
+  Check("base 10 y base 2 coinciden en & y ~^", same_as_decimal);
+
+  std::map<std::string, std::string> values_calculator =
+      Calculate({"A = 10, 12", "B = 10, -5", "H = 16, -F0", "X ? A B &", "Y ? A B |", "Z ? A B ~^", "W ? A ~",
+                 "V ? H A |"});
+  Check("calculadora: &, |, ~^ y ~", values_calculator["X"] == "8" && values_calculator["Y"] == "-1" &&
+                                         values_calculator["Z"] == "-9" && values_calculator["W"] == "-13");
+  Check("calculadora: -F0 | 12 en base 16", values_calculator["V"] == "-E4");
+}
+
+/**
+ * @brief Potencias: ventana deslizante frente a multiplicaciones sucesivas, atajo de las potencias de la
+ * base, signo con base negativa y exponentes 0 y negativos
+ */
+void CheckPow() {
+  BigInt<10> three("3");
+  BigInt<10> product("1");
+  for (int i = 0; i < 1000; i++) {
+    product = product * three;
+  }
+  Check("3^1000 con ventana deslizante", (three ^ BigInt<10>("1000")) == product);
+  Check("(-3)^41 en base 10", (BigInt<10>("-3") ^ BigInt<10>("41")).to_string() == "-36472996377170786403");
+  Check("(-3)^42 es positivo", !(BigInt<10>("-3") ^ BigInt<10>("42")).IsNegative());
+  Check("x^0 y 0^0 dan 1", (three ^ BigInt<10>("0")).to_string() == "1" &&
+                               (BigInt<10>("0") ^ BigInt<10>("0")).to_string() == "1");
+  Check("exponente negativo da 0", (three ^ BigInt<10>("-2")).to_string() == "0");
+
+  // potencias de la base: se construyen como desplazamientos
+  Check("10^25 en base 10", (BigInt<10>("10") ^ BigInt<10>("25")).to_string() == "1" + std::string(25, '0'));
+  Check("(-100)^3 en base 10", (BigInt<10>("-100") ^ BigInt<10>("3")).to_string() == "-1" + std::string(6, '0'));
+  Check("16^10 en base 16", (BigInt<16>("10") ^ BigInt<16>("A")).to_string() == "1" + std::string(10, '0'));
+  Check("2^127 en base 2",
+        Decimal(BigInt<2>("010") ^ BigInt<2>("01111111")) == "170141183460469231731687303715884105728");
+  Check("(-2)^3 en base 2", Decimal(BigInt<2>("110") ^ BigInt<2>("011")) == "-8");
+  Check("base 2 y base 10 coinciden en 3^1000",
+        Decimal(BigInt<2>("011") ^ static_cast<BigInt<2>>(BigInt<10>("1000"))) == product.to_string());
+
+  Check("potencia de la base demasiado grande lanza BigIntOutOfRange",
+        Throws<BigIntOutOfRange>([]() { BigInt<10>("10") ^ BigInt<10>("10000000000000"); }) &&
+            Throws<BigIntOutOfRange>([]() { BigInt<2>("010") ^ BigInt<2>("010000000000000000000000000000000"); }));
+  Check("(-1)^(10^20) no es un desplazamiento fuera de rango",
+        (BigInt<10>("-1") ^ BigInt<10>("100000000000000000000")).to_string() == "1");
+
+  std::map<std::string, std::string> values =
+      Calculate({"A = 10, -3", "B = 10, 41", "T = 10, 10", "E = 10, 10000000000000", "P ? A B ^", "Q ? T E ^",
+                 "R ? A B ^"});
+  Check("calculadora: (-3)^41", values["P"] == "-36472996377170786403");
+  Check("calculadora: potencia de la base demasiado grande da 0 y la línea siguiente se calcula",
+        values["Q"] == "0" && values["R"] == values["P"]);
+}
+
+/**
+ * @brief Potencia modular frente a (x^e) % m con módulos pares e impares de uno y varios limbs, signo de la
+ * base, exponente negativo y módulo 0
+ */
+void CheckPowMod() {
+  BigInt<10> odd = (BigInt<10>("2") ^ BigInt<10>("521")) - BigInt<10>("1");
+  BigInt<10> even = (BigInt<10>("10") ^ BigInt<10>("60")) + BigInt<10>("6");
+  BigInt<10> moduli[] = {BigInt<10>("1"), BigInt<10>("97"), BigInt<10>("1000000"), odd, even, -odd};
+  BigInt<10> bases[] = {BigInt<10>("0"), BigInt<10>("3"), BigInt<10>("-7"), BigInt<10>("123456789123456789123456789")};
+  BigInt<10> exponents[] = {BigInt<10>("0"), BigInt<10>("1"), BigInt<10>("65"), BigInt<10>("1000")};
+  bool same = true;
+  bool same_binary = true;
+  for (auto& modulus : moduli) {
+    for (auto& base : bases) {
+      for (auto& exponent : exponents) {
+        BigInt<10> expected = (base ^ exponent) % modulus;
+        same = same && base.PowMod(exponent, modulus) == expected;
+        BigInt<2> binary = static_cast<BigInt<2>>(base).PowMod(static_cast<BigInt<2>>(exponent),
+                                                                static_cast<BigInt<2>>(modulus));
+        same_binary = same_binary && Decimal(binary) == expected.to_string();
+      }
+    }
+  }
+  Check("PowMod coincide con (x^e) % m en base 10", same);
+  Check("PowMod coincide con (x^e) % m en base 2", same_binary);
+  Check("PowMod con exponente negativo da 0", BigInt<10>("3").PowMod(BigInt<10>("-1"), odd).to_string() == "0");
+  Check("PowMod con módulo 0 lanza BigIntDivisionByZero", Throws<BigIntDivisionByZero>([]() {
+          BigInt<10>("3").PowMod(BigInt<10>("5"), BigInt<10>("0"));
+        }));
+
+  std::map<std::string, std::string> values =
+      Calculate({"A = 10, -7", "B = 10, 3", "M = 10, 10", "Z = 10, 0", "H = 16, 1F", "P ? A B M powmod",
+                 "Q ? A B Z powmod", "R ? H B M powmod"});
+  Check("calculadora: (-7)^3 mod 10", values["P"] == "-3");
+  Check("calculadora: powmod con módulo 0 da 0", values["Q"] == "0");
+  Check("calculadora: 1F^3 mod 10 en base 16", values["R"] == "1");
+}
+
+/**
+ * @brief Restos repetidos por un mismo módulo de más de kBarrettThreshold limbs: la primera vez se divide,
+ * después se reduce con el reductor de Barrett en caché. Se comparan con el resto conocido y con DivMod,
+ * también tras sacar el módulo de la caché con otros módulos
+ */
+void CheckBarrett() {
+  BigInt<10> y = (BigInt<10>("7") ^ BigInt<10>("1000")) + BigInt<10>("12345");  // 846 dígitos, 45 limbs
+  BigInt<10> r = BigInt<10>("5") ^ BigInt<10>("900");
+  BigInt<10> quotients[] = {BigInt<10>("1"), BigInt<10>("3") ^ BigInt<10>("1500"),
+                            BigInt<10>("3") ^ BigInt<10>("6000")};  // el último da más de 2n limbs
+  bool same = true;
+  for (int round = 0; round < 3; round++) {
+    for (auto& q : quotients) {
+      BigInt<10> x = q * y + r;
+      same = same && x % y == r && (-x) % y == -r;
+    }
+  }
+  Check("base 10: restos repetidos por el mismo módulo", same);
+
+  bool same_divmod = true;
+  BigInt<10> x = (BigInt<10>("11") ^ BigInt<10>("1500")) - BigInt<10>("1");
+  BigInt<10> modulus = y;
+  for (int k = 0; k < 10; k++) {  // más módulos que kReducerCacheSize
+    for (int round = 0; round < 3; round++) {
+      same_divmod = same_divmod && x % modulus == x.DivMod(modulus).second;
+    }
+    modulus = modulus + BigInt<10>("1");
+  }
+  same_divmod = same_divmod && x % y == x.DivMod(y).second && x % y == x.DivMod(y).second;
+  Check("base 10: restos con varios módulos en caché coinciden con DivMod", same_divmod);
+
+  BigInt<2> y_binary = static_cast<BigInt<2>>(BigInt<10>("3") ^ BigInt<10>("4000"));  // 6341 bits, 100 palabras
+  BigInt<2> r_binary = static_cast<BigInt<2>>(BigInt<10>("7") ^ BigInt<10>("2000"));
+  BigInt<2> x_binary = static_cast<BigInt<2>>(BigInt<10>("5") ^ BigInt<10>("6000")) * y_binary + r_binary;
+  bool same_binary = true;
+  for (int round = 0; round < 3; round++) {
+    same_binary = same_binary && x_binary % y_binary == r_binary && (-x_binary) % y_binary == -r_binary;
+  }
+  Check("base 2: restos repetidos por el mismo módulo", same_binary);
+}
+
+/**
+ * @brief Factorial por prime-swing frente al producto directo, en base 10 y en binario, con los casos 0, 1 y
+ * negativos y el rechazo de argumentos mayores que kMaxFactorial
+ */
+void CheckFactorial() {
+  BigInt<10> product("1");
+  for (int i = 1; i <= 1000; i++) {
+    product = product * BigInt<10>(static_cast<long>(i));
+  }
+  Check("1000! con prime-swing", (!BigInt<10>("1000")) == product);
+  Check("0! y 1! dan 1", (!BigInt<10>("0")).to_string() == "1" && (!BigInt<10>("1")).to_string() == "1");
+  Check("30! en base 10", (!BigInt<10>("30")).to_string() == "265252859812191058636308480000000");
+  Check("(-5)! en base 10 es el factorial del valor absoluto", (!BigInt<10>("-5")).to_string() == "120");
+  Check("20! en base 16", (!BigInt<16>("14")).to_string() == "21C3677C82B40000");
+  Check("1000! en base 2", Decimal(static_cast<BigInt<2>>(BigInt<10>("1000")).factorial()) == product.to_string());
+  Check("factorial de un negativo en base 2 es 1", Decimal(BigInt<2>("1011").factorial()) == "1");
+  Check("factorial mayor que kMaxFactorial lanza BigIntOutOfRange",
+        Throws<BigIntOutOfRange>([]() { !BigInt<10>("16777217"); }) &&
+            Throws<BigIntOutOfRange>([]() { !BigInt<10>("100000000000000000000"); }) &&
+            Throws<BigIntOutOfRange>([]() { static_cast<BigInt<2>>(BigInt<10>("16777217")).factorial(); }));
+
+  std::map<std::string, std::string> values =
+      Calculate({"A = 10, 25", "H = 16, FFFFFFFFFFFFFFFFFFFF", "F ? A !", "G ? H !"});
+  Check("calculadora: 25!", values["F"] == "15511210043330985984000000");
+  Check("calculadora: factorial demasiado grande da 0", values["G"] == "0");
+}
+
+/**
+ * @brief Máximo común divisor (por encima del umbral del half-gcd), cofactores de Bézout, inverso modular y
+ * mínimo común múltiplo, con operandos negativos, módulos 0 y números no invertibles
+ */
+void CheckGcd() {
+  BigInt<10> g = BigInt<10>("7") ^ BigInt<10>("500");
+  BigInt<10> x = (BigInt<10>("3") ^ BigInt<10>("4000")) * g;                       // 123 limbs
+  BigInt<10> y = ((BigInt<10>("2") ^ BigInt<10>("7000")) + BigInt<10>("1")) * g;  // 133 limbs, coprimo salvo g
+  Check("gcd con half-gcd", x.Gcd(y) == g && (-x).Gcd(y) == g && x.Gcd(BigInt<10>("0")) == x);
+  Check("gcd(0, 0) es 0", BigInt<10>("0").Gcd(BigInt<10>("0")).to_string() == "0");
+  Check("gcd en base 2 coincide con base 10",
+        Decimal(static_cast<BigInt<2>>(x).Gcd(static_cast<BigInt<2>>(-y))) == g.to_string());
+
+  bool bezout = true;
+  BigInt<10> operands[] = {x, -x, y, -y, BigInt<10>("240"), BigInt<10>("-46")};
+  for (auto& a : operands) {
+    for (auto& b : operands) {
+      BigInt<10> s, t;
+      BigInt<10> gcd = a.ExtendedGcd(b, s, t);
+      bezout = bezout && gcd == a.Gcd(b) && s * a + t * b == gcd;
+    }
+  }
+  Check("xgcd cumple s x + t y = gcd con todos los signos", bezout);
+
+  BigInt<10> m = (BigInt<10>("10") ^ BigInt<10>("40")) + BigInt<10>("9");  // 10^40 + 9 no es múltiplo de 3
+  BigInt<10> a = BigInt<10>("-3") ^ BigInt<10>("77");
+  BigInt<10> inverse = a.ModInverse(m);
+  Check("modinv de un negativo en [0, m)",
+        !inverse.IsNegative() && inverse < m && (a * inverse % m + m) % m == BigInt<10>("1"));
+  Check("modinv en base 2 coincide con base 10",
+        Decimal(static_cast<BigInt<2>>(a).ModInverse(static_cast<BigInt<2>>(m))) == inverse.to_string());
+  Check("modinv no invertible lanza BigIntNotInvertible",
+        Throws<BigIntNotInvertible>([]() { BigInt<10>("6").ModInverse(BigInt<10>("9")); }) &&
+            Throws<BigIntNotInvertible>([]() { BigInt<2>("0110").ModInverse(BigInt<2>("01001")); }));
+  Check("modinv con módulo 0 lanza BigIntDivisionByZero",
+        Throws<BigIntDivisionByZero>([]() { BigInt<10>("3").ModInverse(BigInt<10>("0")); }));
+
+  Check("lcm(x, y) gcd(x, y) = |x y|", x.Lcm(-y) * x.Gcd(y) == x * y);
+  Check("lcm(-4, 6) es 12 y lcm con 0 es 0", BigInt<10>("-4").Lcm(BigInt<10>("6")).to_string() == "12" &&
+                                                 BigInt<10>("0").Lcm(BigInt<10>("6")).to_string() == "0");
+
+  BigInt<10> s, t;
+  BigInt<10>("240").ExtendedGcd(BigInt<10>("46"), s, t);
+  std::map<std::string, std::string> values =
+      Calculate({"A = 10, 240", "B = 10, 46", "M = 10, 7", "Z = 10, 0", "G ? A B gcd", "L ? A B lcm",
+                 "I ? A M modinv", "N ? A B modinv", "O ? A Z modinv", "S ? A B xgcd +", "D ? A B xgcd -"});
+  Check("calculadora: gcd y lcm de 240 y 46", values["G"] == "2" && values["L"] == "5520");
+  Check("calculadora: 240^-1 mod 7", values["I"] == "4");
+  Check("calculadora: modinv no invertible o con módulo 0 da 0", values["N"] == "0" && values["O"] == "0");
+  Check("calculadora: xgcd apila s y t", values["S"] == (s + t).to_string() && values["D"] == (s - t).to_string());
+}
+
+/**
+ * @brief Multiplicación por encima de los umbrales de Toom-3, Toom-4 y la NTT, en base 10 y en base 2, con
+ * operandos equilibrados y desequilibrados (por bloques en Toom-4, directamente en la NTT). Los cuadrados
+ * (x * x, que usan los núcleos de cuadrado) se comparan con el producto por una copia de x
+ */
+void CheckMultiplication() {
+  const std::string decimal_digits = "0123456789";
+  const size_t toom3 = Limbs<10>::kToom3Threshold + 10;
+  const size_t toom4 = Limbs<10>::kToom4Threshold + 10;
+  const size_t ntt = Limbs<10>::kNttThreshold + 10;
+  BigInt<10> modulus("1000000000000000009");
+  auto decimal = [&](size_t limbs, uint64_t seed) {
+    return BigInt<10>(RandomDigits(limbs * Limbs<10>::kDigits, decimal_digits, seed).c_str());
+  };
+  Check("base 10: Toom-3", ProductIsRight(decimal(toom3, 1), decimal(toom3, 2), modulus) &&
+                               ProductIsRight(decimal(toom3 + 50, 3), -decimal(toom3, 4), modulus));
+  Check("base 10: Toom-4", ProductIsRight(decimal(toom4, 5), decimal(toom4, 6), modulus));
+  Check("base 10: Toom-4 por bloques con operandos desequilibrados",
+        ProductIsRight(decimal(3 * toom4, 7), decimal(toom4, 8), modulus));
+  Check("base 10: NTT", ProductIsRight(decimal(ntt, 9), -decimal(ntt, 10), modulus) &&
+                            ProductIsRight(decimal(3 * ntt, 19), decimal(ntt + 5, 20), modulus));
+  // (10^k - 1)(10^k - 1) = 10^2k - 2 10^k + 1: todos los limbs al máximo fuerzan los acarreos de la
+  // reconstrucción por el teorema chino del resto
+  BigInt<10> power("1");
+  power <<= ntt * Limbs<10>::kDigits;
+  BigInt<10> power_squared = power;
+  power_squared <<= ntt * Limbs<10>::kDigits;
+  BigInt<10> nines = power - BigInt<10>("1");
+  BigInt<10> other_nines = nines;
+  Check("base 10: NTT con acarreos máximos", nines * other_nines == power_squared - power - power + BigInt<10>("1"));
+
+  const size_t toom3_words = Limbs<2>::kToom3Threshold + 10;
+  const size_t toom4_words = Limbs<2>::kToom4Threshold + 10;
+  const size_t ntt_words = Limbs<2>::kNttThreshold + 10;
+  BigInt<2> binary_modulus = static_cast<BigInt<2>>(modulus);
+  auto binary = [](size_t words, uint64_t seed) {
+    return BigInt<2>(("0" + RandomDigits(64 * words - 1, "01", seed)).c_str());  // positivo: bit de signo a 0
+  };
+  Check("base 2: Toom-3", ProductIsRight(binary(toom3_words, 11), binary(toom3_words, 12), binary_modulus) &&
+                              ProductIsRight(-binary(toom3_words + 100, 13), binary(toom3_words, 14), binary_modulus));
+  Check("base 2: Toom-4", ProductIsRight(binary(toom4_words, 15), binary(toom4_words, 16), binary_modulus));
+  Check("base 2: Toom-4 por bloques con operandos desequilibrados",
+        ProductIsRight(binary(3 * toom4_words, 17), binary(toom4_words, 18), binary_modulus));
+  Check("base 2: NTT", ProductIsRight(binary(ntt_words, 21), binary(ntt_words, 22), binary_modulus) &&
+                           ProductIsRight(binary(3 * ntt_words, 23), -binary(ntt_words + 5, 24), binary_modulus));
+  BigInt<2> binary_power("01");
+  binary_power <<= 64 * ntt_words;
+  BigInt<2> binary_power_squared = binary_power;
+  binary_power_squared <<= 64 * ntt_words;
+  BigInt<2> ones = binary_power - BigInt<2>("01");
+  BigInt<2> other_ones = ones;
+  Check("base 2: NTT con acarreos máximos",
+        ones * other_ones == binary_power_squared - binary_power - binary_power + BigInt<2>("01"));
+
+  const size_t karatsuba_square = Limbs<10>::kKaratsubaSquareThreshold + 10;
+  bool squares = true;
+  uint64_t seed = 31;
+  for (size_t limbs : {karatsuba_square, toom3, toom4, ntt}) {
+    BigInt<10> x = -decimal(limbs, seed++);
+    BigInt<10> copy = x;
+    BigInt<10> square = x * x;
+    squares = squares && square == x * copy && !square.IsNegative();
+  }
+  Check("base 10: cuadrados de Karatsuba, Toom-3, Toom-4 y NTT", squares && nines * nines == nines * other_nines);
+
+  const size_t karatsuba_square_words = Limbs<2>::kKaratsubaSquareThreshold + 10;
+  bool binary_squares = true;
+  for (size_t words : {karatsuba_square_words, toom3_words, toom4_words, ntt_words}) {
+    BigInt<2> x = -binary(words, seed++);
+    BigInt<2> copy = x;
+    binary_squares = binary_squares && x * x == x * copy;
+  }
+  Check("base 2: cuadrados de Karatsuba, Toom-3, Toom-4 y NTT", binary_squares && ones * ones == ones * other_ones);
+}
+
+/**
+ * @brief Operadores compuestos en el lugar (+=, -=, *=, ++ y --): acarreo que atraviesa un limb completo,
+ * préstamo que vacía el limb superior y cambios de signo
+ */
+void CheckCompoundAssignment() {
+  const std::string limb_nines(19, '9');  // 10^19 - 1: un limb de base 10 al máximo
+  BigInt<10> x(limb_nines.c_str());
+  x += BigInt<10>("1");
+  Check("(10^19 - 1) += 1 acarrea a un limb nuevo", x.to_string() == "1" + std::string(19, '0'));
+  x -= BigInt<10>("1");
+  Check("10^19 -= 1 presta del limb superior", x.to_string() == limb_nines);
+  x *= BigInt<10>(limb_nines.c_str());
+  Check("(10^19 - 1) *= (10^19 - 1)", x.to_string() == "99999999999999999980000000000000000001");
+
+  BigInt<10> y((limb_nines + limb_nines).c_str());
+  BigInt<10> old = y++;
+  Check("(10^38 - 1)++ acarrea por dos limbs y devuelve el valor anterior",
+        y.to_string() == "1" + std::string(38, '0') && old.to_string() == limb_nines + limb_nines);
+  --y;
+  Check("--10^38 presta por dos limbs", y.to_string() == limb_nines + limb_nines);
+
+  BigInt<10> z("5");
+  z -= BigInt<10>(("1" + std::string(19, '0')).c_str());
+  Check("5 -= 10^19 cambia de signo", z.to_string() == "-" + std::string(18, '9') + "5");
+  z += BigInt<10>(("1" + std::string(19, '0')).c_str());
+  Check("(5 - 10^19) += 10^19 vuelve a 5", z.to_string() == "5");
+  BigInt<10> minus_one("-1");
+  ++minus_one;
+  Check("++(-1) da 0", minus_one.to_string() == "0");
+  --minus_one;
+  --minus_one;
+  Check("--0 dos veces da -2", minus_one.to_string() == "-2");
+}
+
+/**
+ * @brief Suma y resta con operandos de distinta longitud: el acarreo o el préstamo recorre la cola del
+ * operando largo y puede añadir un limb o vaciar el superior, en los dos órdenes de los operandos
+ */
+void CheckAddSubTails() {
+  const std::string nines(57, '9');  // 10^57 - 1: tres limbs de base 10 al máximo
+  const std::string power = "1" + std::string(57, '0');
+  BigInt<10> long_number(nines.c_str());
+  BigInt<10> one("1");
+  Check("(10^57 - 1) + 1 y 1 + (10^57 - 1) añaden un limb",
+        (long_number + one).to_string() == power && (one + long_number).to_string() == power);
+  BigInt<10> power_number(power.c_str());
+  Check("10^57 - 1 presta por la cola hasta el limb superior",
+        (power_number - one).to_string() == nines && (one - power_number).to_string() == "-" + nines);
+  Check("(10^57 - 1) - (-1) suma con acarreo", (long_number - BigInt<10>("-1")).to_string() == power);
+  Check("-1 + 10^57 resta con préstamo", (BigInt<10>("-1") + power_number).to_string() == nines);
+
+  const std::string hexadecimal_ones(32, 'F');  // 2 limbs de base 16 al máximo
+  const std::string hexadecimal_power = "1" + std::string(32, '0');
+  BigInt<16> hexadecimal(hexadecimal_ones.c_str());
+  Check("base 16: FF...F + 1 añade un limb", (hexadecimal + BigInt<16>("1")).to_string() == hexadecimal_power);
+  Check("base 16: 10...0 - 1 presta hasta el limb superior",
+        (BigInt<16>(hexadecimal_power.c_str()) - BigInt<16>("1")).to_string() == hexadecimal_ones);
+}
+
+/**
+ * @brief Ancho de los resultados de BigInt<2> en complemento a 2: la suma y la resta conservan el ancho del
+ * operando mayor y solo añaden un bit cuando el resultado se desborda, también al cruzar una palabra. El
+ * producto y el cociente se quedan con el ancho mínimo
+ */
+void CheckBinaryWidths() {
+  BigInt<2> x("0011");
+  x += BigInt<2>("01");
+  Check("0011 += 01 mantiene el ancho", x.to_string() == "0100");
+  BigInt<2> overflow("0111");
+  overflow += BigInt<2>("01");
+  Check("0111 += 01 se desborda y añade un bit", overflow.to_string() == "01000");
+  BigInt<2> negative("1000");
+  negative += BigInt<2>("1000");
+  Check("1000 += 1000 se desborda y añade un bit", negative.to_string() == "10000");
+  BigInt<2> carry("0110");
+  carry += BigInt<2>("1110");
+  Check("0110 += 1110 descarta el acarreo del signo", carry.to_string() == "0100");
+  BigInt<2> word(("0" + std::string(63, '1')).c_str());  // 2^63 - 1 ocupa una palabra entera
+  word += BigInt<2>("01");
+  Check("(2^63 - 1) += 1 pasa a la segunda palabra", word.to_string() == "01" + std::string(63, '0'));
+
+  BigInt<2> difference("1000");
+  difference -= BigInt<2>("01");
+  Check("1000 -= 01 se desborda y añade un bit", difference.to_string() == "10111");
+  BigInt<2> increment("0111");
+  ++increment;
+  BigInt<2> decrement("1000");
+  --decrement;
+  Check("++0111 y --1000 añaden un bit", increment.to_string() == "01000" && decrement.to_string() == "10111");
+
+  BigInt<2> product("0111");
+  product *= BigInt<2>("0111");
+  BigInt<2> negative_product("1000");
+  negative_product *= BigInt<2>("1000");
+  Check("0111 *= 0111 y 1000 *= 1000 con el ancho mínimo",
+        product.to_string() == "0110001" && negative_product.to_string() == "01000000");
+  BigInt<2> minimum(("1" + std::string(63, '0')).c_str());  // -2^63, el mínimo de una palabra
+  minimum *= BigInt<2>("1");
+  Check("-2^63 *= -1 pasa a la segunda palabra", minimum.to_string() == "01" + std::string(63, '0'));
+  BigInt<2> quotient = product / BigInt<2>("0111");
+  BigInt<2> negative_quotient = BigInt<2>("1000") / BigInt<2>("1");
+  Check("0110001 / 0111 y 1000 / 1 con el ancho mínimo",
+        quotient.to_string() == "0111" && negative_quotient.to_string() == "01000");
+}
+
 int main() {
  // probar suma de números en distintas bases
   Number* n = Number::create(8, "12");
@@ -50,5 +821,41 @@ int main() {
   delete n2;
   delete n3;
   delete n4;
+
+  // se comprueba que una cadena de operaciones reserva como mucho una vez por resultado
+  std::string decimal_a = "123456789012345678901234567890123456789012345678901234567890";
+  std::string decimal_b = "-98765432109876543210987654321098765432109876543210";
+  std::string decimal_c = "11111111111111111111111111111111111111111111";
+  std::string hexadecimal_a = "FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF";
+  std::string hexadecimal_b = "123456789ABCDEF0123456789ABCDEF";
+  std::string hexadecimal_c = "-ABCDEF";
+  bool allocations_ok = true;
+  allocations_ok &= CheckAllocations(BigInt<10>(decimal_a), BigInt<10>(decimal_b), BigInt<10>(decimal_c));
+  allocations_ok &= CheckAllocations(BigInt<16>(hexadecimal_a), BigInt<16>(hexadecimal_b), BigInt<16>(hexadecimal_c));
+  allocations_ok &= CheckAllocations(BigInt<2>("0110101011101010101010101010101011110000101010101"),
+                                     BigInt<2>("1010101010101111"),
+                                     BigInt<2>("0111111111111111111111111111111111111111111111111111111111111111111"));
+  Check("reservas en a + b - c", allocations_ok);
+
+  // comprobaciones de comportamiento
+  CheckDivision();
+  CheckLargeDivision();
+  CheckDivMod();
+  CheckConversions();
+  CheckShifts();
+  CheckBitwise();
+  CheckPow();
+  CheckPowMod();
+  CheckBarrett();
+  CheckFactorial();
+  CheckGcd();
+  CheckMultiplication();
+  CheckCompoundAssignment();
+  CheckAddSubTails();
+  CheckBinaryWidths();
+  if (failures != 0) {
+    std::cout << "Error: " << failures << " comprobaciones fallidas" << std::endl;
+    return 1;
+  }
   return 0;
 }
\ No newline at end of file